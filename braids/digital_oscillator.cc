@@ -2481,35 +2481,28 @@ void DigitalOscillator::RenderCymbal(
   svf_[0].set_frequency(parameter_[0] >> 1);
   svf_[1].set_frequency(parameter_[0] >> 1);
   
-  while (size--) {
-    phase_ += increments[6];
-    if (phase_ < increments[6]) {
-      hat->rng_state = hat->rng_state * 1664525L + 1013904223L;
-    }
-    hat->phase[0] += increments[0];
-    hat->phase[1] += increments[1];
-    hat->phase[2] += increments[2];
-    hat->phase[3] += increments[3];
-    hat->phase[4] += increments[4];
-    hat->phase[5] += increments[5];
-    
-    int32_t hat_noise = 0;
-    hat_noise += hat->phase[0] >> 31;
-    hat_noise += hat->phase[1] >> 31;
-    hat_noise += hat->phase[2] >> 31;
-    hat_noise += hat->phase[3] >> 31;
-    hat_noise += hat->phase[4] >> 31;
-    hat_noise += hat->phase[5] >> 31;
-    hat_noise -= 3;
-    hat_noise *= 5461;
-    hat_noise = svf_[0].Process(hat_noise);
-    CLIP(hat_noise)
-    
-    int32_t noise = (hat->rng_state >> 16) - 32768;
-    noise = svf_[1].Process(noise >> 1);
-    CLIP(noise)
+  int32_t metallic_noise[32];
+  while (size) {
+    size_t n = std::min(size, sizeof(metallic_noise) / sizeof(int32_t));
+    RenderMetallicNoise(hat->phase, increments, metallic_noise, n);
+    size -= n;
     
-    *buffer++ = hat_noise + ((noise - hat_noise) * xfade >> 15);
+    for (size_t i = 0; i < n; ++i) {
+      phase_ += increments[6];
+      if (phase_ < increments[6]) {
+        hat->rng_state = hat->rng_state * 1664525L + 1013904223L;
+      }
+      
+      int32_t hat_noise = (metallic_noise[i] - 3) * 5461;
+      hat_noise = svf_[0].Process(hat_noise);
+      CLIP(hat_noise)
+      
+      int32_t noise = (hat->rng_state >> 16) - 32768;
+      noise = svf_[1].Process(noise >> 1);
+      CLIP(noise)
+      
+      *buffer++ = hat_noise + ((noise - hat_noise) * xfade >> 15);
+    }
   }
 }
 
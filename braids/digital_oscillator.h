@@ -32,6 +32,7 @@
 #include "stmlib/stmlib.h"
 
 #include "braids/excitation.h"
+#include "braids/metallic_noise.h"
 #include "braids/svf.h"
 
 #include <cstring>
@@ -212,7 +213,7 @@ struct ClockedNoiseState {
 };
 
 struct HatState {
-  uint32_t phase[6];
+  uint32_t phase[kNumMetallicOscillators];
   uint32_t rng_state;
 };
 
@@ -0,0 +1,107 @@
+// Copyright 2013 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+//
+// Bank of 6 square oscillators at inharmonic ratios, summed to produce the
+// metallic noise of the 808 hi-hats and cymbals.
+
+#ifndef BRAIDS_METALLIC_NOISE_H_
+#define BRAIDS_METALLIC_NOISE_H_
+
+#include "stmlib/stmlib.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif  // __SSE2__
+
+namespace braids {
+
+const size_t kNumMetallicOscillators = 6;
+
+// Advances the phases of the 6 oscillators by size samples, and writes in out
+// the number of oscillators in the upper half of their cycle (0 to 6).
+//
+// On the host, the oscillators are rendered one after the other, 4 samples
+// per instruction. Otherwise, the 6 phases are kept in registers and the
+// block is rendered one sample at a time.
+inline void RenderMetallicNoise(
+    uint32_t* phase,
+    const uint32_t* increment,
+    int32_t* out,
+    size_t size) {
+#ifdef __SSE2__
+  for (size_t j = 0; j < kNumMetallicOscillators; ++j) {
+    uint32_t p = phase[j];
+    uint32_t p_increment = increment[j];
+    size_t i = 0;
+    __m128i phases = _mm_set_epi32(
+        p + 4 * p_increment,
+        p + 3 * p_increment,
+        p + 2 * p_increment,
+        p + p_increment);
+    __m128i increments = _mm_set1_epi32(4 * p_increment);
+    for (; i + 4 <= size; i += 4) {
+      __m128i high = _mm_srli_epi32(phases, 31);
+      __m128i* o = reinterpret_cast<__m128i*>(&out[i]);
+      _mm_storeu_si128(o, j ? _mm_add_epi32(_mm_loadu_si128(o), high) : high);
+      phases = _mm_add_epi32(phases, increments);
+    }
+    p += static_cast<uint32_t>(i) * p_increment;
+    for (; i < size; ++i) {
+      p += p_increment;
+      out[i] = (j ? out[i] : 0) + (p >> 31);
+    }
+    phase[j] = p;
+  }
+#else
+  uint32_t p_0 = phase[0];
+  uint32_t p_1 = phase[1];
+  uint32_t p_2 = phase[2];
+  uint32_t p_3 = phase[3];
+  uint32_t p_4 = phase[4];
+  uint32_t p_5 = phase[5];
+  while (size--) {
+    p_0 += increment[0];
+    p_1 += increment[1];
+    p_2 += increment[2];
+    p_3 += increment[3];
+    p_4 += increment[4];
+    p_5 += increment[5];
+    *out++ = (p_0 >> 31) + (p_1 >> 31) + (p_2 >> 31) + \
+        (p_3 >> 31) + (p_4 >> 31) + (p_5 >> 31);
+  }
+  phase[0] = p_0;
+  phase[1] = p_1;
+  phase[2] = p_2;
+  phase[3] = p_3;
+  phase[4] = p_4;
+  phase[5] = p_5;
+#endif  // __SSE2__
+}
+
+}  // namespace braids
+
+#endif  // BRAIDS_METALLIC_NOISE_H_
@@ -40,6 +40,7 @@
 
 const int32_t kCrossFadeSize = 256;
 const int32_t kInterpolationTail = 8;
+const int32_t kWriteChunkSize = 32;
 
 namespace clouds {
 
@@ -140,46 +141,69 @@ class AudioBuffer {
           }
         }
       }
-    } else if (write && !crossfade_counter_ && 
-        resolution == RESOLUTION_16_BIT &&
-        write_head_ >= kInterpolationTail && write_head_ < (size_ - size)) {
-      // Fast write routine for the most common case.
-      while (size--) {
-        s16_[write_head_] = stmlib::Clip16(
-            static_cast<int32_t>(*in * 32767.0f));
-        ++write_head_;
-        in += stride;
-      }
+    } else if (!crossfade_counter_) {
+      WriteBlock(in, size, stride);
     } else {
-      while (size--) {
-        float sample = *in;
-        if (crossfade_counter_) {
-          --crossfade_counter_;
-          float tail_sample = tail_[kCrossFadeSize - crossfade_counter_];
-          float gain = crossfade_counter_ * (1.0f / float(kCrossFadeSize));
-          sample += (tail_sample / 32768.0f - sample) * gain;
+      // Apply the crossfade in a separate pass, so that the encoding loop
+      // in WriteBlock does not have to check for it.
+      float faded[kWriteChunkSize];
+      while (size) {
+        int32_t chunk = std::min(size, kWriteChunkSize);
+        for (int32_t i = 0; i < chunk; ++i) {
+          float sample = *in;
+          if (crossfade_counter_) {
+            --crossfade_counter_;
+            float tail_sample = tail_[kCrossFadeSize - crossfade_counter_];
+            float gain = crossfade_counter_ * (1.0f / float(kCrossFadeSize));
+            sample += (tail_sample / 32768.0f - sample) * gain;
+          }
+          faded[i] = sample;
+          in += stride;
         }
-        Write(sample);
-        in += stride;
+        WriteBlock(faded, chunk, 1);
+        size -= chunk;
       }
     }
   }
   
   inline void Write(const float* in, int32_t size, int32_t stride) {
-    if (resolution == RESOLUTION_16_BIT
-        && write_head_ >= kInterpolationTail && write_head_ < (size_ - size)) {
-      // Fast write routine for the most common case.
-      while (size--) {
-        s16_[write_head_] = stmlib::Clip16(
-            static_cast<int32_t>(*in * 32768.0f));
-        ++write_head_;
-        in += stride;
+    WriteBlock(in, size, stride);
+  }
+  
+  // Encodes a block of samples. The block is split into runs that do not
+  // wrap around the end of the buffer; each run is encoded by a tight loop
+  // specific to the resolution, and the interpolation tail is updated
+  // once per run rather than checked for every sample.
+  inline void WriteBlock(const float* in, int32_t size, int32_t stride) {
+    while (size) {
+      int32_t run = std::min(size, size_ - write_head_);
+      if (resolution == RESOLUTION_16_BIT) {
+        Encode16(in, stride, &s16_[write_head_], run);
+      } else if (resolution == RESOLUTION_8_BIT_DITHERED) {
+        EncodeDithered(in, stride, &s8_[write_head_], run);
+      } else if (resolution == RESOLUTION_8_BIT_MU_LAW) {
+        EncodeMuLaw(in, stride, &s8_[write_head_], run);
+      } else {
+        Encode8(in, stride, &s8_[write_head_], run);
       }
-    } else {
-      while (size--) {
-        Write(*in);
-        in += stride;
+      
+      if (write_head_ < kInterpolationTail) {
+        int32_t tail_end = std::min(write_head_ + run, kInterpolationTail);
+        if (resolution == RESOLUTION_16_BIT) {
+          std::copy(
+              &s16_[write_head_], &s16_[tail_end], &s16_[write_head_ + size_]);
+        } else {
+          std::copy(
+              &s8_[write_head_], &s8_[tail_end], &s8_[write_head_ + size_]);
+        }
+      }
+      
+      write_head_ += run;
+      if (write_head_ >= size_) {
+        write_head_ = 0;
       }
+      in += run * stride;
+      size -= run;
     }
   }
   
@@ -281,6 +305,49 @@ class AudioBuffer {
   inline int32_t head() const { return write_head_; }
   
  private:
+  static inline void Encode16(
+      const float* in, int32_t stride, int16_t* out, int32_t size) {
+    for (int32_t i = 0; i < size; ++i) {
+      out[i] = stmlib::Clip16(static_cast<int32_t>(*in * 32768.0f));
+      in += stride;
+    }
+  }
+  
+  static inline void Encode8(
+      const float* in, int32_t stride, int8_t* out, int32_t size) {
+    for (int32_t i = 0; i < size; ++i) {
+      out[i] = static_cast<int8_t>(stmlib::Clip16(*in * 32768.0f) >> 8);
+      in += stride;
+    }
+  }
+  
+  static inline void EncodeMuLaw(
+      const float* in, int32_t stride, int8_t* out, int32_t size) {
+    for (int32_t i = 0; i < size; ++i) {
+      int16_t sample = stmlib::Clip16(static_cast<int32_t>(*in * 32768.0f));
+      out[i] = Lin2MuLaw(sample);
+      in += stride;
+    }
+  }
+  
+  // The error feedback is a recurrence, so this one stays serial - but the
+  // error is kept in a register for the whole run.
+  inline void EncodeDithered(
+      const float* in, int32_t stride, int8_t* out, int32_t size) {
+    float error = quantization_error_;
+    for (int32_t i = 0; i < size; ++i) {
+      float sample = *in * 127.0f;
+      sample += error;
+      int32_t quantized = static_cast<int32_t>(sample);
+      if (quantized < -127) quantized = -127;
+      else if (quantized > 127) quantized = 127;
+      error = sample - static_cast<float>(*in);
+      out[i] = quantized;
+      in += stride;
+    }
+    quantization_error_ = error;
+  }
+  
   int16_t* s16_;
   int8_t* s8_;
   
@@ -53,6 +53,7 @@ void GranularProcessor::Init(
   num_channels_ = 2;
   low_fidelity_ = false;
   bypass_ = false;
+  grain_cpu_budget_ = 1.0f;
   
   src_down_.Init();
   src_up_.Init();
@@ -609,6 +610,7 @@ void GranularProcessor::Prepare() {
       int32_t num_grains = (num_channels_ == 1 ? 32 : 26) * \
           (low_fidelity_ ? 20 : 16) >> 4;
       player_.Init(num_channels_, num_grains);
+      player_.set_cpu_budget(grain_cpu_budget_);
       ws_player_.Init(&correlator_, num_channels_);
       looper_.Init(num_channels_);
     }
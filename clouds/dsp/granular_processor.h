@@ -151,6 +151,21 @@ class GranularProcessor {
     return quality;
   }
   
+  // Scales the CPU time allowed for grain rendering in granular mode. 1.0 is
+  // the stock setting.
+  inline void set_grain_cpu_budget(float budget) {
+    grain_cpu_budget_ = budget;
+    player_.set_cpu_budget(budget);
+  }
+  
+  inline uint32_t num_dropped_grains() const {
+    return player_.num_dropped_grains();
+  }
+  
+  inline uint32_t num_degraded_grains() const {
+    return player_.num_degraded_grains();
+  }
+  
   void GetPersistentData(PersistentBlock* block, size_t *num_blocks);
   bool LoadPersistentData(const uint32_t* data);
   void PreparePersistentData();
@@ -178,6 +193,7 @@ class GranularProcessor {
   bool reset_buffers_;
   float freeze_lp_;
   float dry_wet_;
+  float grain_cpu_budget_;
   
   void* buffer_[2];
   size_t buffer_size_[2];
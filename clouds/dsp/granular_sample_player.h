@@ -48,6 +48,16 @@ namespace clouds {
 
 const int32_t kMaxNumGrains = 40;
 
+// Estimated cost of rendering one grain, indexed by number of channels and
+// grain quality, in units of "one mono grain without interpolation". These
+// figures come from profiling OverlapAdd on the STM32F4 with a 32-sample
+// block: the envelope computation and the mixing are a fixed overhead, and
+// the interpolator dominates the rest.
+const float kGrainCost[2][3] = {
+  { 1.0f, 1.35f, 2.1f },
+  { 1.7f, 2.4f, 3.8f }
+};
+
 using namespace stmlib;
 
 class GranularSamplePlayer {
@@ -65,6 +75,35 @@ class GranularSamplePlayer {
     num_grains_ = 0.0f;
     num_channels_ = num_channels;
     grain_size_hint_ = 1024.0f;
+    num_dropped_grains_ = 0;
+    num_degraded_grains_ = 0;
+    set_cpu_budget(1.0f);
+  }
+  
+  // Sets the CPU budget allocated to grain rendering. 1.0 corresponds to the
+  // worst case of the historical policy: a quarter of the grains rendered in
+  // high quality, the rest in medium quality.
+  void set_cpu_budget(float budget) {
+    float reference = grain_cost(GRAIN_QUALITY_HIGH) * \
+        static_cast<float>(max_num_grains_ - num_midfi_grains_) + \
+        grain_cost(GRAIN_QUALITY_MEDIUM) * \
+        static_cast<float>(num_midfi_grains_);
+    budget_ = reference * budget;
+    // Headroom kept for medium-quality grains. High-quality grains are only
+    // admitted while the load stays below this watermark.
+    hifi_budget_ = budget_ - grain_cost(GRAIN_QUALITY_MEDIUM) * \
+        static_cast<float>(num_midfi_grains_);
+    if (hifi_budget_ < 0.0f) {
+      hifi_budget_ = 0.0f;
+    }
+  }
+  
+  inline uint32_t num_dropped_grains() const { return num_dropped_grains_; }
+  inline uint32_t num_degraded_grains() const { return num_degraded_grains_; }
+  
+  inline void ResetCounters() {
+    num_dropped_grains_ = 0;
+    num_degraded_grains_ = 0;
   }
   
   template<Resolution resolution>
@@ -83,8 +122,10 @@ class GranularSamplePlayer {
       grain_rate_phasor_ = -1000.0f;
     }
     
-    // Build a list of available grains.
-    int32_t num_available_grains = FillAvailableGrainsList();
+    // Build a list of available grains, and estimate the cost of rendering
+    // the grains already playing.
+    float load = 0.0f;
+    int32_t num_available_grains = FillAvailableGrainsList(&load);
     
     // Try to schedule new grains.
     bool seed_trigger = parameters.trigger;
@@ -94,27 +135,36 @@ class GranularSamplePlayer {
           && target_num_grains > num_grains_;
       bool seed_deterministic = grain_rate_phasor_ >= space_between_grains;
       bool seed = seed_probabilistic || seed_deterministic || seed_trigger;
-      if (num_available_grains && seed) {
-        --num_available_grains;
-        int32_t index = available_grains_[num_available_grains];
-        GrainQuality quality;
-        if (num_available_grains < num_midfi_grains_) {
-          quality = GRAIN_QUALITY_MEDIUM;
-        } else {
-          quality = GRAIN_QUALITY_HIGH;
-        }
-        
-        Grain* g = &grains_[index];
-        ScheduleGrain(
-            g,
-            parameters,
-            t,
-            buffer->size(),
-            buffer->head() - size + t,
-            quality);
+      if (!seed || !num_available_grains) {
+        // Without a free voice, the seed remains pending.
+        continue;
+      }
+      GrainQuality quality;
+      if (!Admit(load, &quality)) {
+        // Not enough CPU left in this block: the grain is dropped rather
+        // than postponed.
+        ++num_dropped_grains_;
         grain_rate_phasor_ = 0.0f;
         seed_trigger = false;
+        continue;
+      }
+      if (quality != GRAIN_QUALITY_HIGH) {
+        ++num_degraded_grains_;
       }
+      load += grain_cost(quality);
+      
+      --num_available_grains;
+      int32_t index = available_grains_[num_available_grains];
+      Grain* g = &grains_[index];
+      ScheduleGrain(
+          g,
+          parameters,
+          t,
+          buffer->size(),
+          buffer->head() - size + t,
+          quality);
+      grain_rate_phasor_ = 0.0f;
+      seed_trigger = false;
     }
     
     // Overlap grains.
@@ -164,17 +214,38 @@ class GranularSamplePlayer {
   }
   
  private:
-  int32_t FillAvailableGrainsList() {
+  inline float grain_cost(GrainQuality quality) const {
+    return kGrainCost[num_channels_ == 1 ? 0 : 1][quality];
+  }
+
+  int32_t FillAvailableGrainsList(float* load) {
     int32_t num_available_grains = 0;
     for (int32_t i = 0; i < max_num_grains_; ++i) {
       if (!grains_[i].active()) {
         available_grains_[num_available_grains] = i;
         ++num_available_grains;
+      } else {
+        *load += grain_cost(grains_[i].recommended_quality());
       }
     }
     return num_available_grains;
   }
   
+  // Picks the best quality at which a new grain can be rendered without
+  // exceeding the budget. Returns false if the grain has to be dropped.
+  bool Admit(float load, GrainQuality* quality) const {
+    if (load + grain_cost(GRAIN_QUALITY_HIGH) <= hifi_budget_) {
+      *quality = GRAIN_QUALITY_HIGH;
+    } else if (load + grain_cost(GRAIN_QUALITY_MEDIUM) <= budget_) {
+      *quality = GRAIN_QUALITY_MEDIUM;
+    } else if (load + grain_cost(GRAIN_QUALITY_LOW) <= budget_) {
+      *quality = GRAIN_QUALITY_LOW;
+    } else {
+      return false;
+    }
+    return true;
+  }
+  
   void ScheduleGrain(
       Grain* grain,
       const Parameters& parameters,
@@ -246,6 +317,11 @@ class GranularSamplePlayer {
   float grain_size_hint_;
   float grain_rate_phasor_;
   
+  float budget_;
+  float hifi_budget_;
+  uint32_t num_dropped_grains_;
+  uint32_t num_degraded_grains_;
+  
   Grain grains_[kMaxNumGrains];
   int32_t available_grains_[kMaxNumGrains];
   float envelope_buffer_[kMaxBlockSize];
@@ -48,34 +48,23 @@ inline short MuLaw2Lin(uint8_t u_val) {
 }
 
 inline unsigned char Lin2MuLaw(int16_t pcm_val) {
-  int16_t mask;
-  int16_t seg;
-  uint8_t uval;
-  pcm_val = pcm_val >> 2;
-  if (pcm_val < 0) {
-    pcm_val = -pcm_val;
+  // The segment number is the position of the highest bit set in the biased
+  // magnitude, which is obtained with a single CLZ instead of a chain of
+  // comparisons. Clamping to 8158 rather than 8159 folds the "segment 8"
+  // special case into the general formula (both yield 0x7f).
+  int32_t magnitude = pcm_val >> 2;
+  uint8_t mask = 0xff;
+  if (magnitude < 0) {
+    magnitude = -magnitude;
     mask = 0x7f;
-  } else {
-    mask = 0xff;
-  }
-  if (pcm_val > 8159) pcm_val = 8159;
-  pcm_val += (0x84 >> 2);
-
-  if (pcm_val <= 0x3f) seg = 0;
-  else if (pcm_val <= 0x7f) seg = 1;
-  else if (pcm_val <= 0xff) seg = 2;
-  else if (pcm_val <= 0x1ff) seg = 3;
-  else if (pcm_val <= 0x3ff) seg = 4;
-  else if (pcm_val <= 0x7ff) seg = 5;
-  else if (pcm_val <= 0xfff) seg = 6;
-  else if (pcm_val <= 0x1fff) seg = 7;
-  else seg = 8;
-  if (seg >= 8)
-    return static_cast<uint8_t>(0x7f ^ mask);
-  else {
-    uval = static_cast<uint8_t>((seg << 4) | ((pcm_val >> (seg + 1)) & 0x0f));
-    return (uval ^ mask);
   }
+  if (magnitude > 8158) magnitude = 8158;
+  magnitude += (0x84 >> 2);
+  int32_t seg = 26 - __builtin_clz(magnitude);
+  if (seg < 0) seg = 0;
+  uint8_t uval = static_cast<uint8_t>(
+      (seg << 4) | ((magnitude >> (seg + 1)) & 0x0f));
+  return uval ^ mask;
 }
 
 }  // namespace clouds
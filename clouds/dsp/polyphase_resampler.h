@@ -0,0 +1,225 @@
+// Copyright 2014 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Polyphase sample rate converter for arbitrary rational ratios (up / down).
+//
+// Unlike SampleRateConverter, the filter is designed at initialization time
+// (windowed sinc), so that any ratio can be used - for example to convert
+// between a 48kHz or 96kHz host and the 32kHz rate of the engine.
+//
+// The history and coefficients are stored interleaved (l, r, l, r...), with
+// each coefficient duplicated for both channels. The inner loop is then a
+// plain multiply-accumulate over contiguous memory, processing two frames
+// (4 floats) per SSE instruction when available.
+
+#ifndef CLOUDS_DSP_POLYPHASE_RESAMPLER_H_
+#define CLOUDS_DSP_POLYPHASE_RESAMPLER_H_
+
+#include "stmlib/stmlib.h"
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif  // __SSE__
+
+#include "clouds/dsp/frame.h"
+
+namespace clouds {
+
+template<int32_t max_num_phases, int32_t max_taps_per_phase>
+class PolyphaseResampler {
+ public:
+  PolyphaseResampler() { }
+  ~PolyphaseResampler() { }
+
+  // Converts from a sample rate proportional to "down" to a sample rate
+  // proportional to "up". For example, Init(2, 3, 32) converts from 48kHz to
+  // 32kHz. Returns false if the ratio requires more phases than available.
+  bool Init(int32_t up, int32_t down, int32_t taps_per_phase) {
+    int32_t gcd = Gcd(up, down);
+    up /= gcd;
+    down /= gcd;
+    if (up > max_num_phases) {
+      return false;
+    }
+
+    // The SIMD kernel processes two frames at a time.
+    taps_per_phase = std::min(taps_per_phase, max_taps_per_phase & ~1);
+    taps_per_phase = (taps_per_phase + 1) & ~1;
+
+    up_ = up;
+    down_ = down;
+    taps_per_phase_ = taps_per_phase;
+    DesignFilter();
+    Reset();
+    return true;
+  }
+
+  void Reset() {
+    std::fill(&history_[0], &history_[kHistorySize], 0.0f);
+    history_ptr_ = taps_per_phase_ - 1;
+    phase_ = 0;
+  }
+
+  // Upper bound on the number of frames produced from input_size frames.
+  inline size_t max_output_size(size_t input_size) const {
+    return (input_size * up_ + down_ - 1) / down_ + 1;
+  }
+
+  // Consumes all the input frames, and returns the number of frames written
+  // to out. out must have room for max_output_size(input_size) frames.
+  size_t Process(const FloatFrame* in, FloatFrame* out, size_t input_size) {
+    const int32_t up = up_;
+    const int32_t down = down_;
+    const int32_t taps = taps_per_phase_;
+    int32_t history_ptr = history_ptr_;
+    int32_t phase = phase_;
+    float* history = history_;
+    size_t produced = 0;
+
+    while (true) {
+      while (phase >= up) {
+        if (!input_size) {
+          history_ptr_ = history_ptr;
+          phase_ = phase;
+          return produced;
+        }
+        // The history is written twice, so that taps_per_phase consecutive
+        // frames can always be read without wrapping around.
+        float* h = &history[2 * history_ptr];
+        h[0] = h[2 * taps] = in->l;
+        h[1] = h[2 * taps + 1] = in->r;
+        ++in;
+        --input_size;
+        --history_ptr;
+        if (history_ptr < 0) {
+          history_ptr += taps;
+        }
+        phase -= up;
+      }
+
+      DotProduct(
+          &history[2 * (history_ptr + 1)],
+          &coefficients_[phase][0],
+          taps,
+          out);
+      ++out;
+      ++produced;
+      phase += down;
+    }
+  }
+
+  inline int32_t up() const { return up_; }
+  inline int32_t down() const { return down_; }
+
+ private:
+  static const int32_t kHistorySize = max_taps_per_phase * 2 * 2;
+
+  static int32_t Gcd(int32_t a, int32_t b) {
+    while (b) {
+      int32_t t = a % b;
+      a = b;
+      b = t;
+    }
+    return a;
+  }
+
+  static inline void DotProduct(
+      const float* x,
+      const float* h,
+      int32_t taps,
+      FloatFrame* out) {
+#ifdef __SSE__
+    __m128 acc = _mm_setzero_ps();
+    for (int32_t i = 0; i < taps; i += 2) {
+      acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(x), _mm_loadu_ps(h)));
+      x += 4;
+      h += 4;
+    }
+    float sum[4];
+    _mm_storeu_ps(sum, acc);
+    out->l = sum[0] + sum[2];
+    out->r = sum[1] + sum[3];
+#else
+    float l = 0.0f;
+    float r = 0.0f;
+    for (int32_t i = 0; i < taps; ++i) {
+      l += x[0] * h[0];
+      r += x[1] * h[1];
+      x += 2;
+      h += 2;
+    }
+    out->l = l;
+    out->r = r;
+#endif  // __SSE__
+  }
+
+  // Blackman-windowed sinc, cutoff set below the Nyquist frequency of the
+  // lowest of the two rates. The filter is decomposed into up_ phases, each
+  // normalized to unity DC gain.
+  void DesignFilter() {
+    const int32_t length = up_ * taps_per_phase_;
+    const float cutoff = 0.45f / static_cast<float>(std::max(up_, down_));
+    const float center = 0.5f * static_cast<float>(length - 1);
+    for (int32_t phase = 0; phase < up_; ++phase) {
+      float sum = 0.0f;
+      for (int32_t tap = 0; tap < taps_per_phase_; ++tap) {
+        int32_t n = phase + tap * up_;
+        float t = static_cast<float>(n) - center;
+        float x = 2.0f * static_cast<float>(M_PI) * cutoff * t;
+        float sinc = t == 0.0f ? 1.0f : sinf(x) / x;
+        float w = static_cast<float>(n) / static_cast<float>(length - 1);
+        float window = 0.42f - 0.5f * cosf(2.0f * static_cast<float>(M_PI) * w)
+            + 0.08f * cosf(4.0f * static_cast<float>(M_PI) * w);
+        float h = sinc * window;
+        coefficients_[phase][2 * tap] = h;
+        coefficients_[phase][2 * tap + 1] = h;
+        sum += h;
+      }
+      float scale = sum != 0.0f ? 1.0f / sum : 0.0f;
+      for (int32_t tap = 0; tap < 2 * taps_per_phase_; ++tap) {
+        coefficients_[phase][tap] *= scale;
+      }
+    }
+  }
+
+  int32_t up_;
+  int32_t down_;
+  int32_t taps_per_phase_;
+  int32_t history_ptr_;
+  int32_t phase_;
+
+  float coefficients_[max_num_phases][max_taps_per_phase * 2];
+  float history_[kHistorySize];
+
+  DISALLOW_COPY_AND_ASSIGN(PolyphaseResampler);
+};
+
+}  // namespace clouds
+
+#endif  // CLOUDS_DSP_POLYPHASE_RESAMPLER_H_
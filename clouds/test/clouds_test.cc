@@ -33,6 +33,7 @@
 #include <xmmintrin.h>
 
 #include "clouds/dsp/granular_processor.h"
+#include "clouds/dsp/polyphase_resampler.h"
 #include "clouds/resources.h"
 
 using namespace clouds;
@@ -41,8 +42,13 @@ using namespace stmlib;
 
 const size_t kSampleRate = 32000;
 const size_t kBlockSize = 32;
+const size_t kHostSampleRate = 48000;
 
-void write_wav_header(FILE* fp, int num_samples, int num_channels) {
+void write_wav_header(
+    FILE* fp,
+    int num_samples,
+    int num_channels,
+    uint32_t sample_rate = kSampleRate) {
   uint32_t l;
   uint16_t s;
   
@@ -58,9 +64,9 @@ void write_wav_header(FILE* fp, int num_samples, int num_channels) {
   fwrite(&s, 2, 1, fp);
   s = num_channels;
   fwrite(&s, 2, 1, fp);
-  l = kSampleRate;
+  l = sample_rate;
   fwrite(&l, 4, 1, fp);
-  l = static_cast<uint32_t>(kSampleRate) * 2 * num_channels;
+  l = sample_rate * 2 * num_channels;
   fwrite(&l, 4, 1, fp);
   s = 2 * num_channels;
   fwrite(&s, 2, 1, fp);
@@ -154,8 +160,87 @@ void TestDSP() {
   fclose(fp_in);
 }
 
+void TestHostSampleRate() {
+  size_t duration = 5;
+  size_t host_size = kHostSampleRate * duration;
+
+  // Synthesize a recording at the host sample rate.
+  vector<FloatFrame> host_in(host_size);
+  float phase = 0.0f;
+  for (size_t i = 0; i < host_size; ++i) {
+    phase += 220.0f / kHostSampleRate;
+    if (phase >= 1.0f) {
+      phase -= 1.0f;
+    }
+    host_in[i].l = 0.5f * sinf(phase * M_PI * 2);
+    host_in[i].r = phase - 0.5f;
+  }
+
+  // Convert it to the engine rate.
+  static PolyphaseResampler<3, 32> down;
+  static PolyphaseResampler<3, 32> up;
+  down.Init(kSampleRate, kHostSampleRate, 32);
+  up.Init(kHostSampleRate, kSampleRate, 32);
+
+  vector<FloatFrame> engine(down.max_output_size(host_size) + kBlockSize);
+  size_t engine_size = down.Process(&host_in[0], &engine[0], host_size);
+  engine_size -= engine_size % kBlockSize;
+
+  uint8_t large_buffer[118784];
+  uint8_t small_buffer[65536 - 128];
+
+  GranularProcessor processor;
+  processor.Init(
+      &large_buffer[0], sizeof(large_buffer),
+      &small_buffer[0],sizeof(small_buffer));
+  processor.set_num_channels(2);
+  processor.set_low_fidelity(false);
+  processor.set_playback_mode(PLAYBACK_MODE_GRANULAR);
+  Parameters* p = processor.mutable_parameters();
+  p->position = 0.5f;
+  p->size = 0.5f;
+  p->pitch = 0.0f;
+  p->density = 0.9f;
+  p->texture = 0.5f;
+  p->dry_wet = 1.0f;
+  p->stereo_spread = 0.0f;
+  p->feedback = 0.0f;
+  p->reverb = 0.0f;
+  processor.Prepare();
+
+  for (size_t i = 0; i < engine_size; i += kBlockSize) {
+    ShortFrame input[kBlockSize];
+    ShortFrame output[kBlockSize];
+    for (size_t j = 0; j < kBlockSize; ++j) {
+      input[j].l = Clip16(static_cast<int32_t>(engine[i + j].l * 32767.0f));
+      input[j].r = Clip16(static_cast<int32_t>(engine[i + j].r * 32767.0f));
+    }
+    processor.Process(input, output, kBlockSize);
+    processor.Prepare();
+    for (size_t j = 0; j < kBlockSize; ++j) {
+      engine[i + j].l = output[j].l / 32768.0f;
+      engine[i + j].r = output[j].r / 32768.0f;
+    }
+  }
+
+  // And back to the host rate.
+  vector<FloatFrame> host_out(up.max_output_size(engine_size));
+  size_t host_out_size = up.Process(&engine[0], &host_out[0], engine_size);
+
+  FILE* fp_out = fopen("clouds_48k.wav", "wb");
+  write_wav_header(fp_out, host_out_size, 2, kHostSampleRate);
+  for (size_t i = 0; i < host_out_size; ++i) {
+    short s[2];
+    s[0] = Clip16(static_cast<int32_t>(host_out[i].l * 32767.0f));
+    s[1] = Clip16(static_cast<int32_t>(host_out[i].r * 32767.0f));
+    fwrite(s, sizeof(short), 2, fp_out);
+  }
+  fclose(fp_out);
+}
+
 int main(void) {
   _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
   TestDSP();
+  TestHostSampleRate();
   // TestGrainSize();
 }
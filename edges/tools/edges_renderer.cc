@@ -0,0 +1,355 @@
+// Copyright 2012 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Offline renderer: plays a batch of scores, each on its own emulated module,
+// and writes the 4 outputs of each module to a 4-channel WAV file.
+//
+// Usage:
+//   edges_renderer jobs.txt [num_threads]
+//
+// Each line of the job list is:
+//   <score file> <wav file, or - to skip writing the audio>
+//
+// A score contains the settings of the module, followed by the MIDI messages:
+//   pw <1-3> <0-5>        pulse width of a square channel (50% ... CV)
+//   shape <0-5>           shape of the 4th channel (triangle ... sine)
+//   cv_pw <0-255>         pulse width when controlled by CV
+//   mode <multi|poly>     MIDI mode
+//   channel <1-16>        MIDI channel
+//   sync <on|off>         channel 2 synced to channel 1
+//   <time in ms> <status> [data 1] [data 2]
+//   end <time in ms>
+// Numbers can be written in hexadecimal (0x90). The rendering stops 1s after
+// the last message when there is no "end" line.
+//
+// For each job, a hash of the rendered samples is printed, so that the output
+// of two versions of the code (for example of the voice allocation) can be
+// compared on a large set of scores.
+
+#include <pthread.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "edges/tools/emulator.h"
+
+using namespace edges;
+using namespace std;
+
+const size_t kRenderBlockSize = 256;
+
+struct ScoreEvent {
+  uint32_t time;  // In samples.
+  uint8_t data[3];
+
+  bool operator<(const ScoreEvent& other) const {
+    return time < other.time;
+  }
+};
+
+struct Job {
+  string score_file_name;
+  string wav_file_name;
+
+  bool success;
+  uint64_t hash;
+  uint32_t num_frames;
+};
+
+bool ParseScore(
+    const char* file_name,
+    EmulatorSettings* settings,
+    vector<ScoreEvent>* events,
+    uint32_t* duration) {
+  FILE* fp = fopen(file_name, "r");
+  if (!fp) {
+    fprintf(stderr, "Could not read %s\n", file_name);
+    return false;
+  }
+  fill(&settings->pw[0], &settings->pw[kNumOutputs], 0);
+  settings->cv_pw = 128;
+  settings->midi_mode = EMULATED_MIDI_MODE_MULTITIMBRAL;
+  settings->midi_channel = 0;
+  settings->sync = false;
+  *duration = 0;
+
+  char line[256];
+  size_t line_number = 0;
+  bool success = true;
+  while (success && fgets(line, sizeof(line), fp)) {
+    ++line_number;
+    char keyword[16];
+    char argument[16];
+    unsigned int value;
+    unsigned int index;
+    if (line[0] == '#' || sscanf(line, "%15s", keyword) != 1) {
+      continue;
+    }
+    if (!strcmp(keyword, "pw")) {
+      success = sscanf(line, "%*s %u %u", &index, &value) == 2 &&
+          index >= 1 && index < kNumOutputs && value <= 5;
+      if (success) {
+        settings->pw[index - 1] = value;
+      }
+    } else if (!strcmp(keyword, "shape")) {
+      success = sscanf(line, "%*s %u", &value) == 1 && value <= 5;
+      if (success) {
+        settings->pw[kNumOutputs - 1] = value;
+      }
+    } else if (!strcmp(keyword, "cv_pw")) {
+      success = sscanf(line, "%*s %u", &value) == 1 && value <= 255;
+      if (success) {
+        settings->cv_pw = value;
+      }
+    } else if (!strcmp(keyword, "mode")) {
+      success = sscanf(line, "%*s %15s", argument) == 1 &&
+          (!strcmp(argument, "multi") || !strcmp(argument, "poly"));
+      if (success) {
+        settings->midi_mode = !strcmp(argument, "poly")
+            ? EMULATED_MIDI_MODE_POLYPHONIC
+            : EMULATED_MIDI_MODE_MULTITIMBRAL;
+      }
+    } else if (!strcmp(keyword, "channel")) {
+      success = sscanf(line, "%*s %u", &value) == 1 &&
+          value >= 1 && value <= 16;
+      if (success) {
+        settings->midi_channel = value - 1;
+      }
+    } else if (!strcmp(keyword, "sync")) {
+      success = sscanf(line, "%*s %15s", argument) == 1 &&
+          (!strcmp(argument, "on") || !strcmp(argument, "off"));
+      if (success) {
+        settings->sync = !strcmp(argument, "on");
+      }
+    } else if (!strcmp(keyword, "end")) {
+      success = sscanf(line, "%*s %u", &value) == 1;
+      if (success) {
+        *duration = static_cast<uint64_t>(value) * kEmulatedSampleRate / 1000;
+      }
+    } else {
+      char* end = line;
+      unsigned long numbers[4];
+      size_t num_numbers = 0;
+      while (num_numbers < 4) {
+        char* start = end;
+        numbers[num_numbers] = strtoul(start, &end, 0);
+        if (end == start) {
+          break;
+        }
+        ++num_numbers;
+      }
+      success = num_numbers >= 2 && numbers[1] >= 0x80 && numbers[1] <= 0xff;
+      if (success) {
+        ScoreEvent e;
+        e.time = static_cast<uint64_t>(numbers[0]) * kEmulatedSampleRate / 1000;
+        e.data[0] = numbers[1];
+        e.data[1] = num_numbers >= 3 ? numbers[2] & 0x7f : 0;
+        e.data[2] = num_numbers >= 4 ? numbers[3] & 0x7f : 0;
+        events->push_back(e);
+      }
+    }
+    if (!success) {
+      fprintf(stderr, "%s:%lu: syntax error\n", file_name, line_number);
+    }
+  }
+  fclose(fp);
+
+  stable_sort(events->begin(), events->end());
+  if (!*duration && !events->empty()) {
+    *duration = events->back().time + kEmulatedSampleRate;
+  }
+  return success;
+}
+
+void WriteWavHeader(FILE* fp, uint32_t num_frames) {
+  uint32_t l;
+  uint16_t s;
+
+  fwrite("RIFF", 4, 1, fp);
+  l = 36 + num_frames * 2 * kNumOutputs;
+  fwrite(&l, 4, 1, fp);
+  fwrite("WAVE", 4, 1, fp);
+
+  fwrite("fmt ", 4, 1, fp);
+  l = 16;
+  fwrite(&l, 4, 1, fp);
+  s = 1;
+  fwrite(&s, 2, 1, fp);
+  s = kNumOutputs;
+  fwrite(&s, 2, 1, fp);
+  l = kEmulatedSampleRate;
+  fwrite(&l, 4, 1, fp);
+  l = kEmulatedSampleRate * 2 * kNumOutputs;
+  fwrite(&l, 4, 1, fp);
+  s = 2 * kNumOutputs;
+  fwrite(&s, 2, 1, fp);
+  s = 16;
+  fwrite(&s, 2, 1, fp);
+
+  fwrite("data", 4, 1, fp);
+  l = num_frames * 2 * kNumOutputs;
+  fwrite(&l, 4, 1, fp);
+}
+
+void RenderJob(Job* job) {
+  EmulatorSettings settings;
+  vector<ScoreEvent> events;
+  uint32_t duration;
+  job->success = ParseScore(
+      job->score_file_name.c_str(), &settings, &events, &duration);
+  job->hash = 0xcbf29ce484222325ULL;
+  job->num_frames = 0;
+  if (!job->success) {
+    return;
+  }
+
+  FILE* fp = NULL;
+  if (job->wav_file_name != "-") {
+    fp = fopen(job->wav_file_name.c_str(), "wb");
+    if (!fp) {
+      fprintf(stderr, "Could not write %s\n", job->wav_file_name.c_str());
+      job->success = false;
+      return;
+    }
+    WriteWavHeader(fp, duration);
+  }
+
+  Emulator emulator;
+  emulator.Init(settings);
+  int16_t block[kRenderBlockSize * kNumOutputs];
+  uint32_t time = 0;
+  vector<ScoreEvent>::const_iterator event = events.begin();
+  while (time < duration) {
+    while (event != events.end() && event->time <= time) {
+      emulator.Message(event->data[0], event->data[1], event->data[2]);
+      ++event;
+    }
+    uint32_t next_event_time = event != events.end()
+        ? event->time
+        : duration;
+    size_t size = min(
+        static_cast<size_t>(min(next_event_time, duration) - time),
+        kRenderBlockSize);
+    emulator.Render(block, size);
+    for (size_t i = 0; i < size * kNumOutputs; ++i) {
+      job->hash = (job->hash ^ static_cast<uint16_t>(block[i])) * \
+          0x100000001b3ULL;
+    }
+    if (fp) {
+      fwrite(block, sizeof(int16_t), size * kNumOutputs, fp);
+    }
+    time += size;
+  }
+  job->num_frames = duration;
+  if (fp) {
+    fclose(fp);
+  }
+}
+
+struct JobQueue {
+  vector<Job>* jobs;
+  size_t next;
+  pthread_mutex_t lock;
+};
+
+void* Worker(void* argument) {
+  JobQueue* queue = static_cast<JobQueue*>(argument);
+  while (true) {
+    pthread_mutex_lock(&queue->lock);
+    size_t index = queue->next++;
+    pthread_mutex_unlock(&queue->lock);
+    if (index >= queue->jobs->size()) {
+      break;
+    }
+    RenderJob(&(*queue->jobs)[index]);
+  }
+  return NULL;
+}
+
+bool ParseJobList(const char* file_name, vector<Job>* jobs) {
+  FILE* fp = fopen(file_name, "r");
+  if (!fp) {
+    return false;
+  }
+  char line[1024];
+  size_t line_number = 0;
+  while (fgets(line, sizeof(line), fp)) {
+    ++line_number;
+    if (line[0] == '#' || line[0] == '\n') {
+      continue;
+    }
+    char score_file_name[512];
+    char wav_file_name[512];
+    if (sscanf(line, "%511s %511s", score_file_name, wav_file_name) != 2) {
+      fprintf(stderr, "%s:%lu: syntax error\n", file_name, line_number);
+      fclose(fp);
+      return false;
+    }
+    Job job;
+    job.score_file_name = score_file_name;
+    job.wav_file_name = wav_file_name;
+    jobs->push_back(job);
+  }
+  fclose(fp);
+  return true;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s jobs.txt [num_threads]\n", argv[0]);
+    return 1;
+  }
+
+  vector<Job> jobs;
+  if (!ParseJobList(argv[1], &jobs)) {
+    fprintf(stderr, "Could not read %s\n", argv[1]);
+    return 1;
+  }
+
+  long num_threads = argc >= 3 ? atoi(argv[2]) : 1;
+  num_threads = max(1L, min(num_threads, long(jobs.size())));
+
+  JobQueue queue;
+  queue.jobs = &jobs;
+  queue.next = 0;
+  pthread_mutex_init(&queue.lock, NULL);
+  vector<pthread_t> threads(num_threads);
+  for (long i = 0; i < num_threads; ++i) {
+    if (pthread_create(&threads[i], NULL, &Worker, &queue)) {
+      fprintf(stderr, "Could not start thread\n");
+      return 1;
+    }
+  }
+  for (long i = 0; i < num_threads; ++i) {
+    pthread_join(threads[i], NULL);
+  }
+  pthread_mutex_destroy(&queue.lock);
+
+  bool success = true;
+  for (size_t i = 0; i < jobs.size(); ++i) {
+    success = success && jobs[i].success;
+    printf("%016llx %10u %s\n",
+           static_cast<unsigned long long>(jobs[i].hash),
+           jobs[i].num_frames,
+           jobs[i].score_file_name.c_str());
+  }
+  return success ? 0 : 1;
+}
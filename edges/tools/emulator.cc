@@ -0,0 +1,535 @@
+// Copyright 2012 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Software emulation of the module, for offline rendering on the host.
+
+#include "edges/tools/emulator.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "edges/resources.h"
+
+namespace edges {
+
+using namespace std;
+
+// Pitch read from the unpatched CV inputs: the MIDI notes are played at their
+// nominal pitch.
+static const int16_t kCvPitch = 60 << 7;
+
+/* EmulatedTimer ------------------------------------------------------------ */
+
+inline uint32_t EmulatedTimer::high_ticks(uint32_t position) const {
+  // The output is cleared when the counter matches CC while counting up, and
+  // set when it matches CC while counting down.
+  uint32_t period = period_;
+  uint32_t compare = compare_;
+  uint32_t falling = compare > period ? period + 1 : compare;
+  uint32_t rising = compare > period ? period + 1 : 2 * period - compare + 1;
+  uint32_t high = min(position, falling);
+  if (position > rising) {
+    high += position - rising;
+  }
+  return high;
+}
+
+uint32_t EmulatedTimer::Run(
+    uint64_t start,
+    uint64_t end,
+    uint32_t* num_ticks,
+    uint64_t* top,
+    uint8_t max_num_tops,
+    uint8_t* num_tops) {
+  uint64_t tick = (start + divider_ - 1) / divider_;
+  uint64_t last_tick = (end + divider_ - 1) / divider_;
+  uint32_t high = 0;
+  *num_ticks = last_tick - tick;
+  if (num_tops) {
+    *num_tops = 0;
+  }
+  while (tick < last_tick) {
+    // UPDATE condition: the buffered values are loaded at BOTTOM.
+    if (phase_ == 0) {
+      period_ = max(period_buffer_, static_cast<uint16_t>(1));
+      compare_ = compare_buffer_;
+    }
+    uint32_t cycle_length = 2 * static_cast<uint32_t>(period_);
+    uint32_t n = min(
+        last_tick - tick,
+        static_cast<uint64_t>(cycle_length - phase_));
+    uint32_t next_phase = phase_ + n;
+    high += high_ticks(next_phase) - high_ticks(phase_);
+    if (num_tops && *num_tops < max_num_tops &&
+        phase_ <= period_ && period_ < next_phase) {
+      top[(*num_tops)++] = (tick + period_ - phase_) * divider_;
+    }
+    tick += n;
+    phase_ = next_phase == cycle_length ? 0 : next_phase;
+  }
+  return high;
+}
+
+/* EmulatedTimerOscillator -------------------------------------------------- */
+
+static const int16_t kOctave = 12 << 7;
+static const int16_t kFirstNoteNormalMode = 24 << 7;
+static const int16_t kFirstNoteLFOMode = -(12 << 7);
+static const uint8_t kPulseWidthCvControlled = 5;
+
+static const uint8_t pulse_widths[] = {
+  128, 85, 64, 32, 13, 10
+};
+
+void EmulatedTimerOscillator::UpdatePitch(
+    int16_t pitch,
+    uint8_t pulse_width) {
+  // TimerOscillator::UpdatePitch(), with TIMER_PRESCALER_CLK_64 and
+  // TIMER_PRESCALER_CLK_8 represented by their division ratio.
+  if (pitch < (24 << 7) && divider_ != 64) {
+    divider_ = 64;
+  }
+  if (pitch > (104 << 7) && divider_ != 8) {
+    divider_ = 8;
+  }
+
+  // TimerOscillator::UpdateTimerParameters().
+  int8_t shifts = 0;
+  pitch -= divider_ == 64 ? kFirstNoteLFOMode : kFirstNoteNormalMode;
+  while (pitch < 0) {
+    pitch += kOctave;
+  }
+  while (pitch >= kOctave) {
+    pitch -= kOctave;
+    ++shifts;
+  }
+  uint16_t index_integral = static_cast<uint16_t>(pitch) >> 4;
+  uint8_t index_fractional = (pitch & 0xf) * 16;
+  uint16_t count = pgm_read_word(lut_res_timer_count + index_integral);
+  uint16_t next = pgm_read_word(lut_res_timer_count + index_integral + 1);
+  count -= static_cast<uint16_t>(count - next) * index_fractional >> 8;
+
+  period_ = count >> shifts;
+  uint8_t pw = pulse_width >= kPulseWidthCvControlled
+      ? cv_pw_
+      : pulse_widths[pulse_width];
+  value_ = static_cast<uint32_t>(period_) * pw >> 8;
+
+  timer_.set_period(period_);
+  timer_.set_divider(divider_);
+}
+
+/* EmulatedDigitalOscillator ------------------------------------------------ */
+
+static const uint8_t kMaxZone = 7;
+static const int16_t kPitchTableStart = 116 * 128;
+static const uint32_t kPhaseMask = 0xffffff;
+
+enum EmulatedOscillatorShape {
+  EMULATED_OSC_TRIANGLE,
+  EMULATED_OSC_NES_TRIANGLE,
+  EMULATED_OSC_PITCHED_NOISE,
+  EMULATED_OSC_NES_NOISE_LONG,
+  EMULATED_OSC_NES_NOISE_SHORT,
+  EMULATED_OSC_SINE,
+  EMULATED_OSC_LAST
+};
+
+// Same result as the assembly version: the table index is given by the 9
+// most significant bits of the phase, and the interpolation coefficient by
+// the next 7 bits, scaled to 8 bits.
+static inline uint16_t InterpolateSample16(
+    const prog_uint8_t* table,
+    uint16_t phase) {
+  const prog_uint8_t* sample = table + (phase >> 7);
+  uint8_t fractional = static_cast<uint8_t>(phase << 1);
+  return pgm_read_byte(sample + 1) * fractional + \
+      pgm_read_byte(sample) * static_cast<uint8_t>(~fractional);
+}
+
+static inline uint8_t InterpolateSample(
+    const prog_uint8_t* table,
+    uint16_t phase) {
+  return InterpolateSample16(table, phase) >> 8;
+}
+
+void EmulatedDigitalOscillator::ComputePhaseIncrement() {
+  int16_t ref_pitch = pitch_ - kPitchTableStart;
+  uint8_t num_shifts = shape_ >= EMULATED_OSC_PITCHED_NOISE ? 0 : 1;
+  while (ref_pitch < 0) {
+    ref_pitch += kOctave;
+    ++num_shifts;
+  }
+  uint16_t pitch_lookup_index_integral = static_cast<uint16_t>(ref_pitch) >> 4;
+  uint8_t pitch_lookup_index_fractional = static_cast<uint8_t>(ref_pitch) << 4;
+  uint16_t increment16 = pgm_read_word(
+      lut_res_oscillator_increments + pitch_lookup_index_integral);
+  uint16_t increment16_next = pgm_read_word(
+      lut_res_oscillator_increments + pitch_lookup_index_integral + 1);
+  uint16_t integral = increment16 + (
+      static_cast<uint16_t>(increment16_next - increment16) * \
+          pitch_lookup_index_fractional >> 8);
+  uint32_t increment = static_cast<uint32_t>(integral) << 8;
+  while (num_shifts--) {
+    increment >>= 1;
+  }
+
+  note_ = static_cast<uint16_t>(pitch_) >> 7;
+  if (note_ < 12) {
+    note_ = 12;
+  }
+  phase_increment_ = increment;
+}
+
+void EmulatedDigitalOscillator::Render(uint16_t* out) {
+  if (!gate_) {
+    RenderSilence(out);
+  } else {
+    ComputePhaseIncrement();
+    uint8_t shape = shape_ < EMULATED_OSC_LAST ? shape_ : EMULATED_OSC_SINE;
+    (this->*fn_table_[shape])(out);
+  }
+}
+
+void EmulatedDigitalOscillator::RenderSilence(uint16_t* out) {
+  fill(&out[0], &out[kEmulatedBlockSize], 2048);
+}
+
+void EmulatedDigitalOscillator::RenderSine(uint16_t* out) {
+  // The table holds 65536 in a 16-bit word for most values of the pulse width
+  // parameter - this reads as 0, as on the AVR.
+  uint16_t aux_phase_increment = pgm_read_word(
+      lut_res_bitcrusher_increments + cv_pw_);
+  uint32_t phase = phase_;
+  for (uint8_t i = 0; i < kEmulatedBlockSize; ++i) {
+    phase = (phase + phase_increment_) & kPhaseMask;
+    aux_phase_ += aux_phase_increment;
+    if (aux_phase_ < aux_phase_increment || !aux_phase_increment) {
+      sample_ = InterpolateSample16(wav_res_bandlimited_triangle_6, phase >> 8);
+    }
+    out[i] = sample_ >> 4;
+  }
+  phase_ = phase;
+}
+
+void EmulatedDigitalOscillator::RenderBandlimitedTriangle(uint16_t* out) {
+  uint8_t balance_index = note_ - 12;
+  balance_index = (balance_index << 4) | (balance_index >> 4);
+  uint8_t gain_2 = balance_index & 0xf0;
+  uint8_t gain_1 = ~gain_2;
+
+  uint8_t wave_index = balance_index & 0xf;
+  uint8_t base_resource_id = (shape_ == EMULATED_OSC_NES_TRIANGLE)
+      ? WAV_RES_BANDLIMITED_NES_TRIANGLE_0
+      : WAV_RES_BANDLIMITED_TRIANGLE_0;
+
+  const prog_uint8_t* wave_1 = waveform_table[base_resource_id + wave_index];
+  wave_index = min(static_cast<uint8_t>(wave_index + 1), kMaxZone);
+  const prog_uint8_t* wave_2 = waveform_table[base_resource_id + wave_index];
+
+  uint32_t phase = phase_;
+  for (uint8_t i = 0; i < kEmulatedBlockSize; ++i) {
+    phase = (phase + phase_increment_) & kPhaseMask;
+    uint16_t sample = InterpolateSample(wave_1, phase >> 8) * gain_1;
+    sample += InterpolateSample(wave_2, phase >> 8) * gain_2;
+    out[i] = sample >> 4;
+  }
+  phase_ = phase;
+}
+
+void EmulatedDigitalOscillator::RenderNoiseNES(uint16_t* out) {
+  uint16_t rng_state = rng_state_;
+  uint16_t sample = sample_;
+  uint32_t phase = phase_;
+  for (uint8_t i = 0; i < kEmulatedBlockSize; ++i) {
+    phase = (phase + phase_increment_) & kPhaseMask;
+    if ((phase >> 8) < (phase_increment_ >> 8)) {
+      uint8_t tap = rng_state >> 1;
+      if (shape_ == EMULATED_OSC_NES_NOISE_SHORT) {
+        tap >>= 5;
+      }
+      uint8_t random_bit = (rng_state ^ tap) & 1;
+      rng_state >>= 1;
+      if (random_bit) {
+        rng_state |= 0x4000;
+        sample = 0x0300;
+      } else {
+        sample = 0x0cff;
+      }
+    }
+    out[i] = sample;
+  }
+  phase_ = phase;
+  rng_state_ = rng_state;
+  sample_ = sample;
+}
+
+void EmulatedDigitalOscillator::RenderNoise(uint16_t* out) {
+  uint16_t rng_state = rng_state_;
+  uint16_t sample = sample_;
+  uint32_t phase = phase_;
+  for (uint8_t i = 0; i < kEmulatedBlockSize; ++i) {
+    phase = (phase + phase_increment_) & kPhaseMask;
+    if ((phase >> 8) < (phase_increment_ >> 8)) {
+      rng_state = (rng_state >> 1) ^ (-(rng_state & 1) & 0xb400);
+      sample = rng_state & 0x0fff;
+      sample = 512 + ((sample * 3) >> 2);
+    }
+    out[i] = sample;
+  }
+  phase_ = phase;
+  rng_state_ = rng_state;
+  sample_ = sample;
+}
+
+/* static */
+const EmulatedDigitalOscillator::RenderFn
+EmulatedDigitalOscillator::fn_table_[] = {
+  &EmulatedDigitalOscillator::RenderBandlimitedTriangle,
+  &EmulatedDigitalOscillator::RenderBandlimitedTriangle,
+  &EmulatedDigitalOscillator::RenderNoise,
+  &EmulatedDigitalOscillator::RenderNoiseNES,
+  &EmulatedDigitalOscillator::RenderNoiseNES,
+  &EmulatedDigitalOscillator::RenderSine,
+};
+
+/* EmulatedMidiHandler ------------------------------------------------------ */
+
+void EmulatedMidiHandler::Init(const EmulatorSettings* settings) {
+  settings_ = settings;
+  memset(pitch_bend_, 0, sizeof(pitch_bend_));
+  Reset();
+}
+
+void EmulatedMidiHandler::Reset() {
+  for (uint8_t channel = 0; channel < kNumOutputs; ++channel) {
+    stack_[channel].Init();
+  }
+  allocator_.Init();
+  allocator_.set_size(4);
+  memset(gate_, false, sizeof(gate_));
+  memset(pitch_, -1, sizeof(pitch_));
+}
+
+bool EmulatedMidiHandler::CheckChannel(uint8_t channel) const {
+  if (settings_->midi_mode == EMULATED_MIDI_MODE_MULTITIMBRAL) {
+    return ((channel - settings_->midi_channel) & 0xf) < kNumOutputs;
+  } else {
+    return channel == settings_->midi_channel;
+  }
+}
+
+void EmulatedMidiHandler::Message(
+    uint8_t status,
+    uint8_t data_1,
+    uint8_t data_2) {
+  uint8_t hi = status & 0xf0;
+  uint8_t lo = status & 0x0f;
+  if (hi == 0xf0 || !CheckChannel(lo)) {
+    return;
+  }
+  switch (hi) {
+    case 0x80:
+      NoteOff(lo, data_1);
+      break;
+
+    case 0x90:
+      if (data_2) {
+        NoteOn(lo, data_1, data_2);
+      } else {
+        NoteOff(lo, data_1);
+      }
+      break;
+
+    case 0xb0:
+      if (data_1 == 0x79) {
+        pitch_bend_[(lo - settings_->midi_channel) & 0xf] = 0;
+      }
+      break;
+
+    case 0xe0:
+      PitchBend(lo, (static_cast<uint16_t>(data_2) << 7) + data_1);
+      break;
+  }
+}
+
+void EmulatedMidiHandler::NoteOn(
+    uint8_t channel,
+    uint8_t note,
+    uint8_t velocity) {
+  channel = (channel - settings_->midi_channel) & 0xf;
+  if (settings_->midi_mode == EMULATED_MIDI_MODE_MULTITIMBRAL) {
+    stack_[channel].NoteOn(note, velocity);
+    pitch_[channel] = stack_[channel].most_recent_note().note << 7;
+  } else {
+    channel = allocator_.NoteOn(note);
+    pitch_[channel] = note << 7;
+  }
+  gate_[channel] = true;
+}
+
+void EmulatedMidiHandler::NoteOff(uint8_t channel, uint8_t note) {
+  channel = (channel - settings_->midi_channel) & 0xf;
+  if (settings_->midi_mode == EMULATED_MIDI_MODE_MULTITIMBRAL) {
+    stack_[channel].NoteOff(note);
+    if (stack_[channel].size()) {
+      pitch_[channel] = stack_[channel].most_recent_note().note << 7;
+    }
+    gate_[channel] = stack_[channel].size() != 0;
+  } else {
+    channel = allocator_.NoteOff(note);
+    if (channel != 0xff) {
+      gate_[channel] = false;
+    }
+  }
+}
+
+void EmulatedMidiHandler::PitchBend(uint8_t channel, uint16_t value) {
+  channel = (channel - settings_->midi_channel) & 0xf;
+  int16_t v = value;
+  v -= 8192;
+  v >>= 5;
+  if (settings_->midi_mode == EMULATED_MIDI_MODE_MULTITIMBRAL) {
+    pitch_bend_[channel] = v;
+  } else {
+    for (uint8_t i = 0; i < kNumOutputs; ++i) {
+      pitch_bend_[i] = v;
+    }
+  }
+}
+
+int16_t EmulatedMidiHandler::shift_pitch(uint8_t channel, int16_t pitch) const {
+  if (pitch_[channel] == -1) {
+    return pitch;
+  }
+  pitch -= (60 << 7);
+  pitch += pitch_[channel];
+  pitch += pitch_bend_[channel];
+  if (pitch < 0) {
+    pitch = 0;
+  } else if (pitch > 16383) {
+    pitch = 16383;
+  }
+  return pitch;
+}
+
+/* Emulator ----------------------------------------------------------------- */
+
+void Emulator::Init(const EmulatorSettings& settings) {
+  settings_ = settings;
+  midi_handler_.Init(&settings_);
+  for (uint8_t i = 0; i < kNumOutputs - 1; ++i) {
+    channel_[i].Init();
+  }
+  digital_channel_.Init();
+  digital_block_ptr_ = kEmulatedBlockSize;
+  adc_stage_ = 0;
+  adc_channel_ = 0;
+  cycle_ = 0;
+}
+
+void Emulator::ControlStep() {
+  if (adc_stage_ == 0) {
+    // A conversion is finished: update the corresponding channel.
+    uint8_t channel = adc_channel_;
+    adc_channel_ = (adc_channel_ + 1) & (kNumOutputs - 1);
+    adc_stage_ = 1;
+    int16_t pitch = midi_handler_.shift_pitch(channel, kCvPitch);
+    if (channel < kNumOutputs - 1) {
+      channel_[channel].UpdatePitch(pitch, settings_.pw[channel]);
+    } else {
+      digital_channel_.UpdatePitch(pitch, settings_.pw[channel]);
+      for (uint8_t i = 0; i < kNumOutputs - 1; ++i) {
+        channel_[i].set_cv_pw(settings_.cv_pw);
+      }
+    }
+  } else {
+    // Otherwise, scan the gates.
+    adc_stage_ = adc_stage_ == 1 ? 2 : 0;
+    for (uint8_t i = 0; i < kNumOutputs - 1; ++i) {
+      channel_[i].Gate(midi_handler_.gate(i));
+    }
+    digital_channel_.Gate(midi_handler_.gate(kNumOutputs - 1));
+  }
+}
+
+static inline int16_t TicksToSample(uint32_t high, uint32_t num_ticks) {
+  if (!num_ticks) {
+    return 0;
+  }
+  int32_t ticks = num_ticks;
+  return (2 * static_cast<int32_t>(high) - ticks) * 32767 / ticks;
+}
+
+void Emulator::RenderSquareChannels(int16_t* out) {
+  uint64_t start = cycle_;
+  uint64_t end = cycle_ + kCyclesPerSample;
+  uint32_t num_ticks;
+  uint32_t high;
+
+  // When sync is enabled, channel 2 is restarted whenever the counter of
+  // channel 1 reaches TOP.
+  uint64_t top[4];
+  uint8_t num_tops = 0;
+  high = channel_[0].mutable_timer()->Run(
+      start, end, &num_ticks,
+      top, settings_.sync ? 4 : 0, &num_tops);
+  out[0] = TicksToSample(high, num_ticks);
+
+  EmulatedTimer* synced = channel_[1].mutable_timer();
+  uint32_t synced_high = 0;
+  uint32_t synced_num_ticks = 0;
+  for (uint8_t i = 0; i < num_tops; ++i) {
+    synced_high += synced->Run(start, top[i], &num_ticks);
+    synced_num_ticks += num_ticks;
+    synced->Restart();
+    start = top[i];
+  }
+  synced_high += synced->Run(start, end, &num_ticks);
+  synced_num_ticks += num_ticks;
+  out[1] = TicksToSample(synced_high, synced_num_ticks);
+
+  high = channel_[2].mutable_timer()->Run(cycle_, end, &num_ticks);
+  out[2] = TicksToSample(high, num_ticks);
+  cycle_ = end;
+}
+
+void Emulator::Render(int16_t* out, size_t size) {
+  while (size) {
+    // Main loop: a block of the digital channel is rendered as soon as there
+    // is room for it in the buffer.
+    if (digital_block_ptr_ == kEmulatedBlockSize) {
+      digital_channel_.Render(digital_block_);
+      digital_block_ptr_ = 0;
+    }
+    size_t n = min(
+        size,
+        static_cast<size_t>(kEmulatedBlockSize - digital_block_ptr_));
+    size -= n;
+    while (n--) {
+      // Audio interrupt.
+      int16_t digital_sample = digital_block_[digital_block_ptr_++];
+      ControlStep();
+      RenderSquareChannels(out);
+      out[3] = (digital_sample - 2048) * 16;
+      out += kNumOutputs;
+    }
+  }
+}
+
+}  // namespace edges
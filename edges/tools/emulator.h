@@ -0,0 +1,308 @@
+// Copyright 2012 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Software emulation of the module, for offline rendering on the host.
+//
+// The firmware relies on static state (the MIDI handler, the ADC pipeline,
+// the audio buffer) and on the XMEGA timers, so it cannot run more than once
+// per process. Here, everything belonging to one module is held by an
+// Emulator object, so that any number of instances can be rendered side by
+// side, for example by a pool of threads.
+//
+// - The 3 square channels are rendered by emulating the timers in dual-slope
+// PWM mode, tick by tick, from the period and compare values computed by
+// TimerOscillator. Each output sample is the fraction of timer ticks during
+// which the output was high.
+// - The 4th channel is a portable version of DigitalOscillator (the sample
+// interpolation is written in AVR assembly in the firmware).
+// - The MIDI messages are handled as by MidiHandler, with the firmware's own
+// NoteStack and VoiceAllocator.
+// - The control code runs on the same schedule as in the audio interrupt:
+// the ADC pipeline updates the pitch of one channel every 3 samples, and the
+// gates are refreshed in between.
+//
+// Assumptions about the hardware: new PER and CC values are applied when the
+// counter reaches BOTTOM, the prescaler is shared by all timers (a timer
+// clocked at CLK/N ticks on CPU cycles multiple of N), and the interrupt
+// latency of the sync (channel 2 restarted when channel 1 overflows) is
+// ignored.
+
+#ifndef EDGES_TOOLS_EMULATOR_H_
+#define EDGES_TOOLS_EMULATOR_H_
+
+#include "avrlibx/avrlibx.h"
+
+#include "edges/note_stack.h"
+#include "edges/voice_allocator.h"
+
+namespace edges {
+
+const uint8_t kNumOutputs = 4;
+const uint8_t kEmulatedBlockSize = 16;  // kAudioBlockSize in the firmware.
+const uint32_t kCyclesPerSample = 666;  // 32MHz / 666 = 48.048kHz.
+const uint32_t kEmulatedSampleRate = 32000000 / kCyclesPerSample;
+
+enum EmulatedMidiMode {
+  EMULATED_MIDI_MODE_MULTITIMBRAL,
+  EMULATED_MIDI_MODE_POLYPHONIC
+};
+
+struct EmulatorSettings {
+  // Pulse width (PulseWidth) of the square channels, and shape
+  // (OscillatorShape) of the digital channel.
+  uint8_t pw[kNumOutputs];
+  // Value read by the firmware on the 4th CV input, used as "CV controlled"
+  // pulse width.
+  uint8_t cv_pw;
+  uint8_t midi_mode;
+  uint8_t midi_channel;
+  bool sync;
+};
+
+// XMEGA 16-bit timer in dual-slope PWM mode, with one compare channel.
+class EmulatedTimer {
+ public:
+  EmulatedTimer() { }
+  ~EmulatedTimer() { }
+
+  void Init() {
+    phase_ = 0;
+    period_ = period_buffer_ = 0xffff;
+    compare_ = compare_buffer_ = 0;
+    divider_ = 8;
+  }
+
+  inline void set_period(uint16_t period) { period_buffer_ = period; }
+  inline void set_value(uint16_t value) { compare_buffer_ = value; }
+  inline void set_divider(uint8_t divider) { divider_ = divider; }
+  inline void Restart() { phase_ = 0; }
+
+  // Runs the timer from CPU cycle start (included) to end (excluded). Returns
+  // the number of ticks during which the output was high, and the number of
+  // ticks in *num_ticks. The cycles at which the counter reached TOP are
+  // written in top, up to max_num_tops of them, and their number in
+  // *num_tops.
+  uint32_t Run(
+      uint64_t start,
+      uint64_t end,
+      uint32_t* num_ticks,
+      uint64_t* top = NULL,
+      uint8_t max_num_tops = 0,
+      uint8_t* num_tops = NULL);
+
+  inline uint16_t period() const { return period_; }
+  inline uint8_t divider() const { return divider_; }
+
+ private:
+  // Number of ticks during which the output is high, for the positions
+  // [0, position) of the counter cycle.
+  inline uint32_t high_ticks(uint32_t position) const;
+
+  // Position in the counter cycle: the counter counts up during the first
+  // period_ ticks, and down during the next period_ ticks.
+  uint32_t phase_;
+  uint16_t period_;
+  uint16_t period_buffer_;
+  uint16_t compare_;
+  uint16_t compare_buffer_;
+  uint8_t divider_;
+
+  DISALLOW_COPY_AND_ASSIGN(EmulatedTimer);
+};
+
+// TimerOscillator, driving an EmulatedTimer.
+class EmulatedTimerOscillator {
+ public:
+  EmulatedTimerOscillator() { }
+  ~EmulatedTimerOscillator() { }
+
+  void Init() {
+    timer_.Init();
+    divider_ = 8;
+    value_ = 0;
+    period_ = 0;
+    cv_pw_ = 0;
+  }
+
+  void UpdatePitch(int16_t pitch, uint8_t pulse_width);
+
+  inline void Gate(bool gate) {
+    timer_.set_value(gate ? value_ : 0);
+  }
+
+  inline void set_cv_pw(uint8_t pw) {
+    if (pw > 250) {
+      pw = 250;
+    }
+    if (pw < 6) {
+      pw = 6;
+    }
+    cv_pw_ = pw;
+  }
+
+  inline EmulatedTimer* mutable_timer() { return &timer_; }
+
+ private:
+  EmulatedTimer timer_;
+
+  uint16_t value_;
+  uint16_t period_;
+  uint8_t cv_pw_;
+  uint8_t divider_;
+
+  DISALLOW_COPY_AND_ASSIGN(EmulatedTimerOscillator);
+};
+
+// DigitalOscillator, rendering one block at a time into a buffer instead of
+// the audio ring buffer.
+class EmulatedDigitalOscillator {
+ public:
+  typedef void (EmulatedDigitalOscillator::*RenderFn)(uint16_t*);
+
+  EmulatedDigitalOscillator() { }
+  ~EmulatedDigitalOscillator() { }
+
+  void Init() {
+    phase_ = 0;
+    phase_increment_ = 0;
+    sample_ = 0;
+    aux_phase_ = 0;
+    cv_pw_ = 0;
+    note_ = 0;
+    UpdatePitch(60 << 7, 0);
+    Gate(true);
+    rng_state_ = 1;
+  }
+
+  inline void UpdatePitch(int16_t pitch, uint8_t shape) {
+    pitch_ = pitch;
+    shape_ = shape;
+  }
+
+  inline void Gate(bool gate) { gate_ = gate; }
+  inline void set_cv_pw(uint8_t pw) { cv_pw_ = pw; }
+
+  // Renders kEmulatedBlockSize 12-bit samples.
+  void Render(uint16_t* out);
+
+ private:
+  void ComputePhaseIncrement();
+
+  void RenderSilence(uint16_t* out);
+  void RenderSine(uint16_t* out);
+  void RenderBandlimitedTriangle(uint16_t* out);
+  void RenderNoiseNES(uint16_t* out);
+  void RenderNoise(uint16_t* out);
+
+  uint8_t shape_;
+  int16_t pitch_;
+  bool gate_;
+
+  uint8_t note_;
+  uint32_t phase_;  // 24 bits: 16 bits integral, 8 bits fractional.
+  uint32_t phase_increment_;
+  uint16_t sample_;
+  uint16_t rng_state_;
+  uint16_t aux_phase_;
+  uint8_t cv_pw_;
+
+  static const RenderFn fn_table_[];
+
+  DISALLOW_COPY_AND_ASSIGN(EmulatedDigitalOscillator);
+};
+
+// MidiHandler, without the static state.
+class EmulatedMidiHandler {
+ public:
+  EmulatedMidiHandler() { }
+  ~EmulatedMidiHandler() { }
+
+  void Init(const EmulatorSettings* settings);
+
+  // Same processing as midi::MidiStreamParser followed by MidiHandler, for
+  // a complete message.
+  void Message(uint8_t status, uint8_t data_1, uint8_t data_2);
+
+  inline bool gate(uint8_t channel) const { return gate_[channel]; }
+  int16_t shift_pitch(uint8_t channel, int16_t pitch) const;
+
+  inline const NoteStack<10>& stack(uint8_t channel) const {
+    return stack_[channel];
+  }
+  inline const VoiceAllocator& allocator() const { return allocator_; }
+
+ private:
+  void Reset();
+  bool CheckChannel(uint8_t channel) const;
+  void NoteOn(uint8_t channel, uint8_t note, uint8_t velocity);
+  void NoteOff(uint8_t channel, uint8_t note);
+  void PitchBend(uint8_t channel, uint16_t value);
+
+  const EmulatorSettings* settings_;
+
+  bool gate_[kNumOutputs];
+  int16_t pitch_[kNumOutputs];
+  int16_t pitch_bend_[kNumOutputs];
+
+  NoteStack<10> stack_[kNumOutputs];
+  VoiceAllocator allocator_;
+
+  DISALLOW_COPY_AND_ASSIGN(EmulatedMidiHandler);
+};
+
+class Emulator {
+ public:
+  Emulator() { }
+  ~Emulator() { }
+
+  void Init(const EmulatorSettings& settings);
+
+  inline void Message(uint8_t status, uint8_t data_1, uint8_t data_2) {
+    midi_handler_.Message(status, data_1, data_2);
+  }
+
+  // Renders size frames of the 4 outputs, interleaved.
+  void Render(int16_t* out, size_t size);
+
+  inline const EmulatedMidiHandler& midi_handler() const {
+    return midi_handler_;
+  }
+
+ private:
+  // What the audio interrupt does, besides writing a sample to the DAC.
+  void ControlStep();
+  void RenderSquareChannels(int16_t* out);
+
+  EmulatorSettings settings_;
+  EmulatedMidiHandler midi_handler_;
+
+  EmulatedTimerOscillator channel_[kNumOutputs - 1];
+  EmulatedDigitalOscillator digital_channel_;
+
+  uint16_t digital_block_[kEmulatedBlockSize];
+  uint8_t digital_block_ptr_;
+
+  uint8_t adc_stage_;
+  uint8_t adc_channel_;
+  uint64_t cycle_;
+
+  DISALLOW_COPY_AND_ASSIGN(Emulator);
+};
+
+}  // namespace edges
+
+#endif  // EDGES_TOOLS_EMULATOR_H_
@@ -0,0 +1,36 @@
+// Copyright 2012 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Host replacement for <avr/pgmspace.h>: on the host, the "program memory"
+// tables are ordinary constant arrays.
+
+#ifndef EDGES_TOOLS_HOST_AVR_PGMSPACE_H_
+#define EDGES_TOOLS_HOST_AVR_PGMSPACE_H_
+
+#include <stdint.h>
+
+#define PROGMEM
+
+typedef char prog_char;
+typedef uint8_t prog_uint8_t;
+typedef uint16_t prog_uint16_t;
+typedef uint32_t prog_uint32_t;
+
+#define pgm_read_byte(address) (*(const uint8_t*)(address))
+#define pgm_read_word(address) (*(const uint16_t*)(address))
+
+#endif  // EDGES_TOOLS_HOST_AVR_PGMSPACE_H_
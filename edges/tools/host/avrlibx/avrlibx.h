@@ -0,0 +1,31 @@
+// Copyright 2012 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Host replacement for the subset of avrlibx used by the modules emulated by
+// the host tools (note stack, voice allocator, resources).
+
+#ifndef EDGES_TOOLS_HOST_AVRLIBX_AVRLIBX_H_
+#define EDGES_TOOLS_HOST_AVRLIBX_AVRLIBX_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define DISALLOW_COPY_AND_ASSIGN(TypeName) \
+  TypeName(const TypeName&);               \
+  void operator=(const TypeName&)
+
+#endif  // EDGES_TOOLS_HOST_AVRLIBX_AVRLIBX_H_
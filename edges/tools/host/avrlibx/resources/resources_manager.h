@@ -0,0 +1,55 @@
+// Copyright 2012 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Host replacement for the avrlibx resources manager.
+
+#ifndef EDGES_TOOLS_HOST_AVRLIBX_RESOURCES_RESOURCES_MANAGER_H_
+#define EDGES_TOOLS_HOST_AVRLIBX_RESOURCES_RESOURCES_MANAGER_H_
+
+#include <avr/pgmspace.h>
+
+#include "avrlibx/avrlibx.h"
+
+namespace avrlibx {
+
+template<
+    const prog_char* const* strings,
+    const prog_uint16_t* const* lookup_tables>
+struct ResourcesTables {
+  static inline const prog_char* const* string_table() { return strings; }
+  static inline const prog_uint16_t* const* lookup_table_table() {
+    return lookup_tables;
+  }
+};
+
+template<typename ResourceId, typename Tables>
+class ResourcesManager {
+ public:
+  template<typename ResultType, typename IndexType>
+  static inline ResultType Lookup(const ResultType* p, IndexType i) {
+    return p[i];
+  }
+
+  template<typename DataType>
+  static inline void Load(const DataType* p, uint16_t i, DataType* destination) {
+    *destination = p[i];
+  }
+};
+
+}  // namespace avrlibx
+
+#endif  // EDGES_TOOLS_HOST_AVRLIBX_RESOURCES_RESOURCES_MANAGER_H_
@@ -0,0 +1,227 @@
+// Copyright 2012 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Stack of currently pressed keys, indexed by note number.
+//
+// Same interface and behaviour as NoteStack, plus the lowest and highest
+// notes. Each node is linked both in the order of play and in the order of
+// pitch, and a map gives the node holding each note - packed as nibbles,
+// since there are at most 15 nodes. NoteOff and the queries of the
+// most/least recent and lowest/highest notes do not depend on the number of
+// notes in the stack. NoteOn is not constant time: it searches the map, note
+// by note, for the held note closest in pitch to the new one.
+//
+// This costs 64 bytes for the map, plus 3 bytes per node: with a capacity of
+// 10, 136 bytes instead of 46 for NoteStack. This is too much for the 4KB of
+// RAM of the ATxmega32A4, so the firmware uses NoteStack. This class is only
+// used by the host tools.
+
+#ifndef EDGES_TOOLS_INDEXED_NOTE_STACK_H_
+#define EDGES_TOOLS_INDEXED_NOTE_STACK_H_
+
+#include "avrlibx/avrlibx.h"
+
+#include <string.h>
+
+#include "edges/note_stack.h"
+
+namespace edges {
+
+struct IndexedNoteEntry {
+  uint8_t note;
+  uint8_t velocity;
+  uint8_t next_ptr;  // Base 1. Less recently played note.
+  uint8_t previous_ptr;  // Base 1. More recently played note.
+  uint8_t higher_ptr;  // Base 1.
+  uint8_t lower_ptr;  // Base 1.
+};
+
+// Notes are in the 0-127 range.
+template<uint8_t capacity>
+class IndexedNoteStack {
+ public: 
+  IndexedNoteStack() { }
+  void Init() { Clear(); }
+
+  void NoteOn(uint8_t note, uint8_t velocity) {
+    // Remove the note from the list first (in case it is already here).
+    NoteOff(note);
+    // In case of saturation, remove the least recently played note from the
+    // stack.
+    if (size_ == capacity) {
+      NoteOff(pool_[least_recent_ptr_].note);
+    }
+    // Now we are ready to insert the new note.
+    uint8_t slot = free_ptr_;
+    IndexedNoteEntry* entry = &pool_[slot];
+    free_ptr_ = entry->next_ptr;
+    entry->note = note;
+    entry->velocity = velocity;
+    
+    // Insert it at the head of the list in the order of play.
+    entry->previous_ptr = 0;
+    entry->next_ptr = root_ptr_;
+    if (root_ptr_) {
+      pool_[root_ptr_].previous_ptr = slot;
+    } else {
+      least_recent_ptr_ = slot;
+    }
+    root_ptr_ = slot;
+    
+    // Insert it next to the closest note in the order of pitch.
+    uint8_t higher = 0;
+    uint8_t lower = 0;
+    if (size_) {
+      uint8_t up = note;
+      uint8_t down = note;
+      while (true) {
+        if (up < 127 && (higher = slot_of(++up)) != 0) {
+          lower = pool_[higher].lower_ptr;
+          break;
+        }
+        if (down > 0 && (lower = slot_of(--down)) != 0) {
+          higher = pool_[lower].higher_ptr;
+          break;
+        }
+      }
+    }
+    entry->higher_ptr = higher;
+    entry->lower_ptr = lower;
+    if (higher) {
+      pool_[higher].lower_ptr = slot;
+    } else {
+      highest_ptr_ = slot;
+    }
+    if (lower) {
+      pool_[lower].higher_ptr = slot;
+    } else {
+      lowest_ptr_ = slot;
+    }
+    
+    set_slot_of(note, slot);
+    ++size_;
+  }
+  
+  void NoteOff(uint8_t note) {
+    uint8_t current = slot_of(note);
+    if (!current) {
+      return;
+    }
+    IndexedNoteEntry* entry = &pool_[current];
+    if (entry->previous_ptr) {
+      pool_[entry->previous_ptr].next_ptr = entry->next_ptr;
+    } else {
+      root_ptr_ = entry->next_ptr;
+    }
+    if (entry->next_ptr) {
+      pool_[entry->next_ptr].previous_ptr = entry->previous_ptr;
+    } else {
+      least_recent_ptr_ = entry->previous_ptr;
+    }
+    if (entry->lower_ptr) {
+      pool_[entry->lower_ptr].higher_ptr = entry->higher_ptr;
+    } else {
+      lowest_ptr_ = entry->higher_ptr;
+    }
+    if (entry->higher_ptr) {
+      pool_[entry->higher_ptr].lower_ptr = entry->lower_ptr;
+    } else {
+      highest_ptr_ = entry->lower_ptr;
+    }
+    set_slot_of(note, 0);
+    
+    memset(entry, 0, sizeof(IndexedNoteEntry));
+    entry->note = kFreeSlot;
+    entry->next_ptr = free_ptr_;
+    free_ptr_ = current;
+    --size_;
+  }
+  
+  void Clear() {
+    size_ = 0;
+    memset(pool_, 0, sizeof(pool_));
+    memset(slot_, 0, sizeof(slot_));
+    for (uint8_t i = 0; i <= capacity; ++i) {
+      pool_[i].note = kFreeSlot;
+    }
+    // The free slots are chained through next_ptr.
+    for (uint8_t i = 1; i < capacity; ++i) {
+      pool_[i].next_ptr = i + 1;
+    }
+    free_ptr_ = 1;
+    root_ptr_ = 0;
+    least_recent_ptr_ = 0;
+    lowest_ptr_ = 0;
+    highest_ptr_ = 0;
+  }
+
+  uint8_t size() const { return size_; }
+  const IndexedNoteEntry& most_recent_note() const { return pool_[root_ptr_]; }
+  const IndexedNoteEntry& least_recent_note() const {
+    return pool_[least_recent_ptr_];
+  }
+  const IndexedNoteEntry& lowest_note() const { return pool_[lowest_ptr_]; }
+  const IndexedNoteEntry& highest_note() const { return pool_[highest_ptr_]; }
+  const IndexedNoteEntry& played_note(uint8_t index) const {
+    uint8_t current = least_recent_ptr_;
+    for (uint8_t i = 0; i < index; ++i) {
+      current = pool_[current].previous_ptr;
+    }
+    return pool_[current];
+  }
+  const IndexedNoteEntry& sorted_note(uint8_t index) const {
+    uint8_t current = lowest_ptr_;
+    for (uint8_t i = 0; i < index; ++i) {
+      current = pool_[current].higher_ptr;
+    }
+    return pool_[current];
+  }
+  const IndexedNoteEntry& note(uint8_t index) const { return pool_[index]; }
+  const IndexedNoteEntry& dummy() const { return pool_[0]; }
+
+ private:
+  inline uint8_t slot_of(uint8_t note) const {
+    uint8_t pair = slot_[note >> 1];
+    return note & 1 ? pair >> 4 : pair & 0x0f;
+  }
+
+  inline void set_slot_of(uint8_t note, uint8_t slot) {
+    uint8_t* pair = &slot_[note >> 1];
+    if (note & 1) {
+      *pair = (*pair & 0x0f) | (slot << 4);
+    } else {
+      *pair = (*pair & 0xf0) | slot;
+    }
+  }
+
+  typedef char CapacityMustFitInANibble[capacity <= 15 ? 1 : -1];
+
+  uint8_t size_;
+  IndexedNoteEntry pool_[capacity + 1];  // First element is a dummy node!
+  uint8_t slot_[64];  // Base 1, 0 for notes which are not in the stack.
+  uint8_t free_ptr_;  // Base 1.
+  uint8_t root_ptr_;  // Base 1.
+  uint8_t least_recent_ptr_;  // Base 1.
+  uint8_t lowest_ptr_;  // Base 1.
+  uint8_t highest_ptr_;  // Base 1.
+
+  DISALLOW_COPY_AND_ASSIGN(IndexedNoteStack);
+};
+
+}  // namespace edges
+
+#endif  // EDGES_TOOLS_INDEXED_NOTE_STACK_H_
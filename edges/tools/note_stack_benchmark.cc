@@ -0,0 +1,197 @@
+// Copyright 2012 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Benchmark of NoteStack and IndexedNoteStack on dense MIDI streams.
+//
+// Usage: note_stack_benchmark [number of messages per stream]
+//
+// The streams are replayed on both stacks: the notes returned by the queries
+// must be identical after each message. Then, the time spent per message by
+// each implementation is printed.
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <vector>
+
+#include "edges/note_stack.h"
+#include "edges/tools/indexed_note_stack.h"
+
+using namespace edges;
+using namespace std;
+
+const uint8_t kStackSize = 10;
+const int kNumRepetitions = 20;
+
+/* Streams ------------------------------------------------------------------ */
+
+struct NoteMessage {
+  bool on;
+  uint8_t note;
+  uint8_t velocity;
+};
+
+typedef vector<NoteMessage> Stream;
+
+void Push(Stream* stream, bool on, uint8_t note) {
+  NoteMessage m;
+  m.on = on;
+  m.note = note & 0x7f;
+  m.velocity = on ? 1 + rand() % 127 : 0;
+  stream->push_back(m);
+}
+
+// Fast glissando: each note is released a few notes after being played.
+void MakeGlissando(size_t size, uint8_t overlap, Stream* stream) {
+  uint8_t note = 36;
+  int8_t direction = 1;
+  while (stream->size() < size) {
+    Push(stream, true, note);
+    Push(stream, false, note - direction * overlap);
+    note += direction;
+    if (note == 96 || note == 36) {
+      direction = -direction;
+    }
+  }
+}
+
+// Chords of up to 16 notes, played and released in random order, with many
+// more notes held than slots in the stack.
+void MakeClusters(size_t size, Stream* stream) {
+  vector<uint8_t> held;
+  while (stream->size() < size) {
+    if (!held.empty() && (held.size() >= 16 || rand() % 2)) {
+      size_t i = rand() % held.size();
+      Push(stream, false, held[i]);
+      held.erase(held.begin() + i);
+    } else {
+      uint8_t note = 48 + rand() % 24;
+      held.push_back(note);
+      Push(stream, true, note);
+    }
+  }
+}
+
+// Many independent notes across the whole range, as received from an MPE
+// controller merged onto one channel, including spurious note offs.
+void MakeScatter(size_t size, Stream* stream) {
+  while (stream->size() < size) {
+    Push(stream, rand() % 3 != 0, rand() % 128);
+  }
+}
+
+/* Checks and timing -------------------------------------------------------- */
+
+template<typename Entry>
+inline uint32_t Signature(const Entry& e) {
+  return e.note | (e.velocity << 8);
+}
+
+bool CheckStacks(const Stream& stream) {
+  // Static, so that the dummy entries are zero-initialized as in the
+  // firmware.
+  static IndexedNoteStack<kStackSize> stack;
+  static NoteStack<kStackSize> reference;
+  stack.Init();
+  reference.Init();
+  for (size_t i = 0; i < stream.size(); ++i) {
+    const NoteMessage& m = stream[i];
+    if (m.on) {
+      stack.NoteOn(m.note, m.velocity);
+      reference.NoteOn(m.note, m.velocity);
+    } else {
+      stack.NoteOff(m.note);
+      reference.NoteOff(m.note);
+    }
+    bool match = stack.size() == reference.size() &&
+        Signature(stack.most_recent_note()) == \
+            Signature(reference.most_recent_note()) &&
+        Signature(stack.least_recent_note()) == \
+            Signature(reference.least_recent_note());
+    for (uint8_t j = 0; j < stack.size(); ++j) {
+      match = match &&
+          Signature(stack.played_note(j)) == \
+              Signature(reference.played_note(j)) &&
+          Signature(stack.sorted_note(j)) == \
+              Signature(reference.sorted_note(j));
+    }
+    if (stack.size()) {
+      match = match &&
+          Signature(stack.lowest_note()) == \
+              Signature(reference.sorted_note(0)) &&
+          Signature(stack.highest_note()) == \
+              Signature(reference.sorted_note(reference.size() - 1));
+    }
+    if (!match) {
+      fprintf(stderr, "Note stacks differ after message %lu\n", i);
+      return false;
+    }
+  }
+  return true;
+}
+
+template<typename Stack>
+double TimeStack(const Stream& stream) {
+  Stack stack;
+  uint32_t checksum = 0;
+  clock_t start = clock();
+  for (int r = 0; r < kNumRepetitions; ++r) {
+    stack.Init();
+    for (size_t i = 0; i < stream.size(); ++i) {
+      const NoteMessage& m = stream[i];
+      if (m.on) {
+        stack.NoteOn(m.note, m.velocity);
+      } else {
+        stack.NoteOff(m.note);
+      }
+      checksum += stack.most_recent_note().note;
+    }
+  }
+  clock_t end = clock();
+  if (checksum == 0xffffffff) {
+    printf("%u\n", checksum);
+  }
+  return 1e9 * (end - start) / CLOCKS_PER_SEC / \
+      (kNumRepetitions * stream.size());
+}
+
+int main(int argc, char** argv) {
+  size_t size = argc >= 2 ? atoi(argv[1]) : 1000000;
+  srand(42);
+
+  const char* names[] = { "glissando", "legato", "clusters", "scatter" };
+  Stream streams[4];
+  MakeGlissando(size, 3, &streams[0]);
+  MakeGlissando(size, 1, &streams[1]);
+  MakeClusters(size, &streams[2]);
+  MakeScatter(size, &streams[3]);
+
+  printf("%-12s %14s %14s\n", "ns/message", "NoteStack", "Indexed");
+  bool success = true;
+  for (size_t i = 0; i < 4; ++i) {
+    if (!CheckStacks(streams[i])) {
+      fprintf(stderr, "Mismatch on stream %s\n", names[i]);
+      success = false;
+      continue;
+    }
+    printf("%-12s %14.1f %14.1f\n",
+           names[i],
+           TimeStack<NoteStack<kStackSize> >(streams[i]),
+           TimeStack<IndexedNoteStack<kStackSize> >(streams[i]));
+  }
+  return success ? 0 : 1;
+}
@@ -53,6 +53,7 @@ void Exciter::Init() {
   particle_state_ = 0.5f;
   damping_ = 0.0f;
   signature_ = 0.0f;
+  sample_bank_ = &kBuiltinSampleBank;
 }
 
 float Exciter::GetPulseAmplitude(float cutoff) {
@@ -88,7 +89,7 @@ void Exciter::ProcessGranularSamplePlayer(
   const uint32_t restart_point = uint32_t(parameter_ * 32767.0f) << 17;
   const uint32_t phase_increment = static_cast<uint32_t>(
       131072.0f * SemitonesToRatio(72.0f * timbre_ - 60.0f));
-  const int16_t* base = &smp_noise_sample[static_cast<size_t>(
+  const int16_t* base = &sample_bank_->noise_sample[static_cast<size_t>(
       signature_ * 8192.0f)];
   
   uint32_t phase = phase_;
@@ -116,10 +117,12 @@ void Exciter::ProcessSamplePlayer(
     index_fractional = 1.0f;
   }
   
-  const uint32_t offset_1 = smp_boundaries[index_integral];
-  const uint32_t offset_2 = smp_boundaries[index_integral + 1];
+  const int16_t* sample_data = sample_bank_->sample_data;
+  const size_t* boundaries = sample_bank_->boundaries;
+  const uint32_t offset_1 = boundaries[index_integral];
+  const uint32_t offset_2 = boundaries[index_integral + 1];
   const uint32_t length_1 = offset_2 - offset_1 - 1;
-  const uint32_t length_2 = smp_boundaries[index_integral + 2] - offset_2 - 1;
+  const uint32_t length_2 = boundaries[index_integral + 2] - offset_2 - 1;
   const uint32_t phase_increment = static_cast<uint32_t>(
       65536.0f * SemitonesToRatio(72.0f * timbre_ - 36.0f + 7.0f));
   
@@ -141,14 +144,14 @@ void Exciter::ProcessSamplePlayer(
     float sample_2 = 0.0f;
     bool step = false;
     if (phase_integral < length_1) {
-      const int16_t* base = &smp_sample_data[offset_1 + phase_integral];
+      const int16_t* base = &sample_data[offset_1 + phase_integral];
       float a = static_cast<float>(base[0]);
       float b = static_cast<float>(base[1]);
       sample_1 = a + (b - a) * phase_fractional;
       step = true;
     }
     if (phase_integral < length_2) {
-      const int16_t* base = &smp_sample_data[offset_2 + phase_integral];
+      const int16_t* base = &sample_data[offset_2 + phase_integral];
       float a = static_cast<float>(base[0]);
       float b = static_cast<float>(base[1]);
       sample_2 = a + (b - a) * phase_fractional;
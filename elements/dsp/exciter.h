@@ -34,6 +34,8 @@
 #include "stmlib/dsp/filter.h"
 #include "stmlib/utils/random.h"
 
+#include "elements/dsp/sample_bank.h"
+
 namespace elements {
 
 enum ExciterModel {
@@ -77,6 +79,10 @@ class Exciter {
     timbre_ = timbre;
   }
   
+  inline void set_sample_bank(const SampleBank* sample_bank) {
+    sample_bank_ = sample_bank;
+  }
+  
   inline void set_meta(float meta, ExciterModel first, ExciterModel last) {
     meta *= static_cast<float>(last - first + 1);
     MAKE_INTEGRAL_FRACTIONAL(meta);
@@ -123,6 +129,8 @@ class Exciter {
   uint32_t delay_;
   uint32_t plectrum_delay_;
   
+  const SampleBank* sample_bank_;
+  
   static ProcessFn fn_table_[];
   
   DISALLOW_COPY_AND_ASSIGN(Exciter);
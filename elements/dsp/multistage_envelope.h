@@ -31,6 +31,8 @@
 
 #include "stmlib/stmlib.h"
 
+#include <algorithm>
+
 #include "elements/resources.h"
 
 namespace elements {
@@ -91,9 +93,25 @@ class MultistageEnvelope {
     return value_;
   }
 
+  // Block version. Edges and segment transitions go through the
+  // single-sample code above; the samples in-between are rendered by runs,
+  // without re-evaluating the segment state for each of them.
   inline void Process(const uint8_t* flags_in, float* out, size_t size) {
-    while (size--) {
-      *out++ = Process(*flags_in++);
+    while (size) {
+      uint8_t flags = *flags_in++;
+      *out++ = Process(flags);
+      --size;
+      if (flags & (ENVELOPE_FLAG_RISING_EDGE | ENVELOPE_FLAG_FALLING_EDGE)) {
+        continue;
+      }
+      size_t run = 0;
+      while (run < size && flags_in[run] == flags) {
+        ++run;
+      }
+      run = RenderSegment(flags, out, run);
+      flags_in += run;
+      out += run;
+      size -= run;
     }
   }
 
@@ -334,6 +352,35 @@ class MultistageEnvelope {
     return a + (b - a) * fractional;
   }
 
+  // Renders up to size samples of the current segment, with the flags kept
+  // constant. Stops at the end of the segment, and returns the number of
+  // samples written.
+  inline size_t RenderSegment(uint8_t flags, float* out, size_t size) {
+    bool done = segment_ == num_segments_;
+    bool sustained = sustain_point_ && segment_ == sustain_point_ &&
+        flags & ENVELOPE_FLAG_GATE;
+    if (sustained || done) {
+      std::fill(&out[0], &out[size], value_);
+      return size;
+    }
+
+    const float increment = Interpolate8(lut_env_increments, time_[segment_]);
+    const float* table = lookup_table_table[LUT_ENV_LINEAR + shape_[segment_]];
+    const float start_value = start_value_;
+    const float delta = level_[segment_ + 1] - start_value;
+    float phase = phase_;
+    float value = value_;
+    size_t n = 0;
+    while (n < size && phase < 1.0f) {
+      value = start_value + delta * Interpolate8(table, phase);
+      phase += increment;
+      out[n++] = value;
+    }
+    phase_ = phase;
+    value_ = value;
+    return n;
+  }
+
   float level_[kMaxNumSegments];
   float time_[kMaxNumSegments];
   EnvelopeShape shape_[kMaxNumSegments];
@@ -112,6 +112,46 @@ void Spatializer::Process(
   }
 }
 
+void Spatializer::ProcessFused(
+    const float* source,
+    float* center,
+    float* sides,
+    size_t size) {
+  float angle = angle_;
+  float x = distance_ * stmlib::InterpolateWrap(
+      lut_sine, angle, 4096.0f);
+  float y = distance_ * stmlib::InterpolateWrap(
+      lut_sine, angle + 0.25f, 4096.0f);
+  float backfront = (1.0f + y) * 0.5f * distance_;
+  x += fixed_position_ * (1.0f - distance_);
+
+  float target_left = stmlib::InterpolateWrap(
+      lut_sine, (1.0f + x) * 0.125f, 4096.0f);
+  float target_right = stmlib::InterpolateWrap(
+      lut_sine, (3.0f + x) * 0.125f, 4096.0f);
+
+  // The left/right gains are ramped linearly, so are their mid/side
+  // combinations.
+  float step = 1.0f / static_cast<float>(size);
+  float left_increment = (target_left - left_) * step;
+  float right_increment = (target_right - right_) * step;
+  float mid = (left_ + right_) * 0.5f;
+  float side = (left_ - right_) * (0.5f / 0.7f);
+  float mid_increment = (left_increment + right_increment) * 0.5f;
+  float side_increment = (left_increment - right_increment) * (0.5f / 0.7f);
+
+  for (size_t i = 0; i < size; ++i) {
+    mid += mid_increment;
+    side += side_increment;
+    float s = source[i];
+    float behind = behind_filter_.Process<FILTER_MODE_LOW_PASS>(s);
+    float y = s + backfront * (behind - s);
+    center[i] += mid * y;
+    sides[i] += side * y;
+  }
+  left_ = target_left;
+  right_ = target_right;
+}
 
 void FmOscillator::Process(
     float frequency,
@@ -187,6 +227,7 @@ void OminousVoice::Init() {
     
     spatializer_[i].Init(i == 0 ? - 0.7f : 0.7f);
   }
+  reference_kernels_ = false;
 }
 
 void OminousVoice::ConfigureEnvelope(const Patch& patch) {
@@ -283,7 +324,17 @@ void OminousVoice::Process(
         osc_oversampled_,
         size * kOversamplingUp,
         1);
-    fir_downsampler_[i].Process(osc_oversampled_, osc_, size * kOversamplingUp);
+    if (reference_kernels_) {
+      fir_downsampler_[i].Process(
+          osc_oversampled_,
+          osc_,
+          size * kOversamplingUp);
+    } else {
+      fir_downsampler_[i].ProcessSymmetric(
+          osc_oversampled_,
+          osc_,
+          size * kOversamplingUp);
+    }
     
     // Copy to raw buffer.
     float level_state = osc_level_[i];
@@ -312,7 +363,11 @@ void OminousVoice::Process(
     
     spatializer_[i].Rotate(f * rotation_speed[i]);
     spatializer_[i].set_distance(distance * (2.0f - distance));
-    spatializer_[i].Process(osc_, center, sides, size);
+    if (reference_kernels_) {
+      spatializer_[i].Process(osc_, center, sides, size);
+    } else {
+      spatializer_[i].ProcessFused(osc_, center, sides, size);
+    }
   }
   
   level_state_ = level;
@@ -36,6 +36,10 @@
 #include "stmlib/dsp/dsp.h"
 #include "stmlib/dsp/filter.h"
 
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif  // __SSE__
+
 #include "elements/dsp/dsp.h"
 #include "elements/dsp/multistage_envelope.h"
 #include "elements/dsp/patch.h"
@@ -74,6 +78,45 @@ class FIRDownsampler {
     }
   }
   
+  // Same as above, for a symmetric (linear phase) filter: the two halves of
+  // the delay line are folded before the multiplication, halving the number
+  // of multiplies.
+  void ProcessSymmetric(const float* in, float* out, size_t size) {
+    const int32_t half = filter_size / 2;
+    while (size) {
+      for (int32_t i = 0; i < ratio; ++i) {
+        buffer_[ptr_ + buffer_size] = buffer_[ptr_] = *in++;
+        ptr_ = (ptr_ + (buffer_size - 1)) & (buffer_size - 1);
+        size--;
+      }
+      const float* x = &buffer_[ptr_ + 1];
+      const float* x_reversed = &buffer_[ptr_ + filter_size];
+      int32_t i = 0;
+      float s = 0.0f;
+#ifdef __SSE__
+      __m128 acc = _mm_setzero_ps();
+      for (; i + 4 <= half; i += 4) {
+        __m128 a = _mm_loadu_ps(x + i);
+        __m128 b = _mm_loadu_ps(x_reversed - i - 3);
+        b = _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 1, 2, 3));
+        acc = _mm_add_ps(
+            acc,
+            _mm_mul_ps(_mm_add_ps(a, b), _mm_loadu_ps(coefficients_ + i)));
+      }
+      float sum[4];
+      _mm_storeu_ps(sum, acc);
+      s = (sum[0] + sum[1]) + (sum[2] + sum[3]);
+#endif  // __SSE__
+      for (; i < half; ++i) {
+        s += (x[i] + x_reversed[-i]) * coefficients_[i];
+      }
+      if (filter_size & 1) {
+        s += x[half] * coefficients_[half];
+      }
+      *out++ = s;
+    }
+  }
+  
  private:
   int32_t ptr_;
   const float* coefficients_;
@@ -103,6 +146,14 @@ class Spatializer {
   }
 
   void Process(float* source, float* center, float* sides, size_t size);
+  
+  // Single pass version of Process: the behind filter, the panning and the
+  // mid/side mix are computed in the same loop.
+  void ProcessFused(
+      const float* source,
+      float* center,
+      float* sides,
+      size_t size);
 
  private:
   float behind_[kMaxBlockSize];
@@ -186,6 +237,12 @@ class OminousVoice {
       float* sides,
       size_t size);
   
+  // The single-pass/folded kernels are used by default. The original
+  // kernels are kept for reference.
+  inline void set_reference_kernels(bool reference_kernels) {
+    reference_kernels_ = reference_kernels;
+  }
+  
  private:
   void ConfigureEnvelope(const Patch& patch);
 
@@ -256,6 +313,8 @@ class OminousVoice {
   
   Spatializer spatializer_[kNumOscillators];
   
+  bool reference_kernels_;
+  
   DISALLOW_COPY_AND_ASSIGN(OminousVoice);
 };
 
@@ -79,6 +79,13 @@ class Part {
   inline bool easter_egg() const { return easter_egg_; }
   inline void set_easter_egg(bool easter_egg) { easter_egg_ = easter_egg; }
   
+  // The bank is only referenced, and can be shared by several parts.
+  inline void set_sample_bank(const SampleBank* sample_bank) {
+    for (size_t i = 0; i < kNumVoices; ++i) {
+      voice_[i].set_sample_bank(sample_bank);
+    }
+  }
+  
  private:
   Patch patch_;
   Voice voice_[kNumVoices];
@@ -44,6 +44,9 @@ using namespace stmlib;
 void Resonator::Init() {
   for (size_t i = 0; i < kMaxModes; ++i) {
     f_[i].Init();
+    mode_active_[i] = true;
+    mode_quiet_samples_[i] = 0;
+    mode_energy_[i] = 0.0f;
   }
 
   for (size_t i = 0; i < kMaxBowedModes; ++i) {
@@ -118,6 +121,50 @@ size_t Resonator::ComputeFilters() {
   return num_modes;
 }
 
+void Resonator::UpdateActiveModes(
+    const float* in,
+    size_t size,
+    size_t num_modes) {
+  float peak = 0.0f;
+  for (size_t i = 0; i < size; ++i) {
+    float x = fabs(in[i]);
+    if (x > peak) {
+      peak = x;
+    }
+  }
+  bool excited = peak > kModeExcitationThreshold;
+  
+  num_active_modes_ = 0;
+  num_amplitudes_ = 0;
+  for (size_t i = 0; i < num_modes; ++i) {
+    if (excited) {
+      mode_active_[i] = true;
+      mode_quiet_samples_[i] = 0;
+    }
+    if (mode_active_[i]) {
+      active_modes_[num_active_modes_++] = i;
+      num_amplitudes_ = i + 1;
+    }
+  }
+}
+
+void Resonator::RetireSilentModes(size_t size) {
+  float period = min(1.0f / frequency_, 16384.0f);
+  float threshold = kModeEnergyThreshold * static_cast<float>(size);
+  for (size_t j = 0; j < num_active_modes_; ++j) {
+    size_t i = active_modes_[j];
+    if (mode_energy_[i] < threshold) {
+      mode_quiet_samples_[i] += size;
+      if (mode_quiet_samples_[i] >= period) {
+        mode_active_[i] = false;
+      }
+    } else {
+      mode_quiet_samples_[i] = 0;
+    }
+    mode_energy_[i] = 0.0f;
+  }
+}
+
 void Resonator::Process(
     const float* bow_strength,
     const float* in,
@@ -126,6 +173,8 @@ void Resonator::Process(
     size_t size) {
   size_t num_modes = ComputeFilters();
   size_t num_banded_wg = min(kMaxBowedModes, num_modes);
+  UpdateActiveModes(in, size, num_modes);
+  const size_t block_size = size;
   // Linearly interpolate position. This parameter is extremely sensitive to
   // zipper noise.
   float position_increment = (position_ - previous_position_) / size;
@@ -159,12 +208,21 @@ void Resonator::Process(
     // partials may not be in an integer ratios, what we are doing here is
     // approximative when the stretch factor is non null.
     // It sounds interesting nevertheless.
+    //
+    // Only the modes still ringing are rendered. The amplitudes are a
+    // recurrence, and are computed up to the last active mode.
     amplitudes.Start();
     aux_amplitudes.Start();
-    for (size_t i = 0; i < num_modes; i++) {
+    for (size_t i = 0; i < num_amplitudes_; ++i) {
+      amplitude_[i] = amplitudes.Next();
+      aux_amplitude_[i] = aux_amplitudes.Next();
+    }
+    for (size_t j = 0; j < num_active_modes_; ++j) {
+      size_t i = active_modes_[j];
       s = f_[i].Process<FILTER_MODE_BAND_PASS>(input);
-      sum_center += s * amplitudes.Next();
-      sum_side += s * aux_amplitudes.Next();
+      sum_center += s * amplitude_[i];
+      sum_side += s * aux_amplitude_[i];
+      mode_energy_[i] += s * s;
     }
     *sides++ = sum_side - sum_center;
     
@@ -182,6 +240,8 @@ void Resonator::Process(
     bow_signal_ = BowTable(bow_signal, *bow_strength++);
     *center++ = sum_center;
   }
+  
+  RetireSilentModes(block_size);
 }
 
 }  // namespace elements
@@ -44,6 +44,13 @@ const size_t kMaxModes = 64;
 const size_t kMaxBowedModes = 8;
 const size_t kMaxDelayLineSize = 1024;
 
+// A mode whose mean squared output stays below this level for more than a
+// period of the fundamental is removed from the active set.
+const float kModeEnergyThreshold = 1.0e-10f;
+
+// Any input above this level re-admits all the modes.
+const float kModeExcitationThreshold = 1.0e-4f;
+
 class Resonator {
  public:
   Resonator() { }
@@ -104,6 +111,8 @@ class Resonator {
   
  private:
   size_t ComputeFilters();
+  void UpdateActiveModes(const float* in, size_t size, size_t num_modes);
+  void RetireSilentModes(size_t size);
   
   float frequency_;
   float geometry_;
@@ -124,6 +133,16 @@ class Resonator {
   stmlib::Svf f_bow_[kMaxBowedModes];
   stmlib::DelayLine<float, kMaxDelayLineSize> d_bow_[kMaxBowedModes];
   
+  // Compacted list of the modes still ringing.
+  size_t active_modes_[kMaxModes];
+  size_t num_active_modes_;
+  size_t num_amplitudes_;
+  bool mode_active_[kMaxModes];
+  size_t mode_quiet_samples_[kMaxModes];
+  float mode_energy_[kMaxModes];
+  float amplitude_[kMaxModes];
+  float aux_amplitude_[kMaxModes];
+  
   size_t clock_divider_;
   
   DISALLOW_COPY_AND_ASSIGN(Resonator);
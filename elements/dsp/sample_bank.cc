@@ -0,0 +1,141 @@
+// Copyright 2014 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Sample data used by the sample player exciters.
+
+#include "elements/dsp/sample_bank.h"
+
+#ifdef TEST
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#endif  // TEST
+
+#include "elements/resources.h"
+
+namespace elements {
+
+/* extern */
+const SampleBank kBuiltinSampleBank = {
+  smp_sample_data,
+  smp_boundaries,
+  smp_noise_sample,
+  SMP_NOISE_SAMPLE_SIZE
+};
+
+#ifdef TEST
+
+bool SampleBankFile::Load(const char* file_name) {
+  Unload();
+  
+  int fd = open(file_name, O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) < 0 ||
+      static_cast<size_t>(st.st_size) < sizeof(SampleBankFileHeader)) {
+    close(fd);
+    return false;
+  }
+  size_t size = st.st_size;
+  void* data = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    return false;
+  }
+  
+  const SampleBankFileHeader* header = static_cast<const SampleBankFileHeader*>(
+      data);
+  bool valid = !memcmp(header->magic, "ESMP", 4) &&
+      header->version == kSampleBankFileVersion &&
+      header->num_samples == kNumExciterSamples &&
+      header->noise_sample_size >= kMinNoiseSampleSize &&
+      header->boundaries[0] == 0;
+  // Each sample needs at least one sample and its interpolation tail.
+  for (size_t i = 0; valid && i < kNumExciterSamples; ++i) {
+    valid = header->boundaries[i + 1] >= header->boundaries[i] + 2;
+  }
+  size_t sample_data_size = header->boundaries[kNumExciterSamples];
+  valid = valid && size >= sizeof(SampleBankFileHeader) + sizeof(int16_t) * (
+      header->noise_sample_size + sample_data_size);
+  if (!valid) {
+    munmap(data, size);
+    return false;
+  }
+  
+  const int16_t* samples = reinterpret_cast<const int16_t*>(header + 1);
+  for (size_t i = 0; i <= kNumExciterSamples; ++i) {
+    boundaries_[i] = header->boundaries[i];
+  }
+  bank_.noise_sample = samples;
+  bank_.noise_sample_size = header->noise_sample_size;
+  bank_.sample_data = samples + header->noise_sample_size;
+  bank_.boundaries = boundaries_;
+  data_ = data;
+  size_ = size;
+  return true;
+}
+
+void SampleBankFile::Unload() {
+  if (data_) {
+    munmap(data_, size_);
+    data_ = NULL;
+    size_ = 0;
+  }
+}
+
+/* static */
+bool SampleBankFile::Save(const char* file_name, const SampleBank& bank) {
+  FILE* fp = fopen(file_name, "wb");
+  if (!fp) {
+    return false;
+  }
+  SampleBankFileHeader header;
+  memcpy(header.magic, "ESMP", 4);
+  header.version = kSampleBankFileVersion;
+  header.num_samples = kNumExciterSamples;
+  header.noise_sample_size = bank.noise_sample_size;
+  for (size_t i = 0; i <= kNumExciterSamples; ++i) {
+    header.boundaries[i] = bank.boundaries[i];
+  }
+  size_t sample_data_size = bank.boundaries[kNumExciterSamples];
+  bool success = fwrite(&header, sizeof(header), 1, fp) == 1 &&
+      fwrite(bank.noise_sample, sizeof(int16_t), bank.noise_sample_size, fp) ==
+          bank.noise_sample_size &&
+      fwrite(bank.sample_data, sizeof(int16_t), sample_data_size, fp) ==
+          sample_data_size;
+  fclose(fp);
+  return success;
+}
+
+#endif  // TEST
+
+}  // namespace elements
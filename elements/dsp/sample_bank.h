@@ -0,0 +1,102 @@
+// Copyright 2014 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Sample data used by the sample player exciters.
+//
+// The exciters read their samples through a SampleBank, which by default
+// points to the data built into the firmware. On the host, a bank can also be
+// memory-mapped from a file, and shared (read-only) by any number of parts.
+
+#ifndef ELEMENTS_DSP_SAMPLE_BANK_H_
+#define ELEMENTS_DSP_SAMPLE_BANK_H_
+
+#include "stmlib/stmlib.h"
+
+namespace elements {
+
+const size_t kNumExciterSamples = 9;
+
+// The granular player reads up to 32768 samples from an offset of up to 8192
+// samples.
+const size_t kMinNoiseSampleSize = 8192 + 32768 + 2;
+
+struct SampleBank {
+  // All the one-shot samples, concatenated. Each sample ends with a copy of
+  // its last value, for interpolation.
+  const int16_t* sample_data;
+  // Start offset of each sample in sample_data, plus the total size.
+  const size_t* boundaries;
+  const int16_t* noise_sample;
+  size_t noise_sample_size;
+};
+
+extern const SampleBank kBuiltinSampleBank;
+
+#ifdef TEST
+
+// File layout: a SampleBankFileHeader, followed by the noise sample, followed
+// by the one-shot samples. All integers are little-endian.
+struct SampleBankFileHeader {
+  char magic[4];  // "ESMP"
+  uint32_t version;
+  uint32_t num_samples;
+  uint32_t noise_sample_size;
+  uint32_t boundaries[kNumExciterSamples + 1];
+};
+
+const uint32_t kSampleBankFileVersion = 1;
+
+class SampleBankFile {
+ public:
+  SampleBankFile() : data_(NULL), size_(0) { }
+  ~SampleBankFile() { Unload(); }
+  
+  // Maps the file in memory. The pages are shared with all the other
+  // processes mapping the same file. The bank must not be unloaded while
+  // some exciters still use it.
+  bool Load(const char* file_name);
+  void Unload();
+  
+  static bool Save(const char* file_name, const SampleBank& bank);
+  
+  inline bool loaded() const { return data_ != NULL; }
+  inline const SampleBank& bank() const { return bank_; }
+  
+ private:
+  void* data_;
+  size_t size_;
+  
+  size_t boundaries_[kNumExciterSamples + 1];
+  SampleBank bank_;
+  
+  DISALLOW_COPY_AND_ASSIGN(SampleBankFile);
+};
+
+#endif  // TEST
+
+}  // namespace elements
+
+#endif  // ELEMENTS_DSP_SAMPLE_BANK_H_
@@ -63,6 +63,12 @@ class Voice {
       size_t size);
   // For metering.
   inline float exciter_level() const { return exciter_level_; }
+  
+  inline void set_sample_bank(const SampleBank* sample_bank) {
+    bow_.set_sample_bank(sample_bank);
+    blow_.set_sample_bank(sample_bank);
+    strike_.set_sample_bank(sample_bank);
+  }
   void Panic() {
     ResetResonator();
   }
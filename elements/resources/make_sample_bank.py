@@ -0,0 +1,70 @@
+#!/usr/bin/python2.5
+#
+# Copyright 2014 Emilie Gillet.
+#
+# Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -----------------------------------------------------------------------------
+#
+# Builds a sample bank file (see elements/dsp/sample_bank.h) from a directory
+# containing hit_01.wav ... hit_09.wav and noise.wav.
+#
+# Usage: make_sample_bank.py <directory> <bank file>
+
+import numpy
+import struct
+import sys
+
+import audio_io
+
+NUM_SAMPLES = 9
+MIN_NOISE_SAMPLE_SIZE = 8192 + 32768 + 2
+VERSION = 1
+
+
+def LoadSample(file_name):
+  audio_data, sr = audio_io.ReadWavFile(file_name)
+  audio_data = audio_data.sum(axis=1)
+  return numpy.round(numpy.array(audio_data) * 32767.0)
+
+
+def main(argv):
+  if len(argv) != 3:
+    print 'Usage: %s <directory> <bank file>' % argv[0]
+    sys.exit(1)
+  directory, bank_file = argv[1:]
+
+  boundaries = [0]
+  sample_data = []
+  for i in xrange(1, NUM_SAMPLES + 1):
+    audio_data = list(LoadSample('%s/hit_%02d.wav' % (directory, i)))
+    audio_data += [audio_data[-1]]  # Add interpolation tail
+    sample_data += audio_data
+    boundaries.append(boundaries[-1] + len(audio_data))
+
+  noise = list(LoadSample('%s/noise.wav' % directory))
+  if len(noise) < MIN_NOISE_SAMPLE_SIZE:
+    noise *= MIN_NOISE_SAMPLE_SIZE / len(noise) + 1
+
+  f = file(bank_file, 'wb')
+  f.write('ESMP')
+  f.write(struct.pack('<III', VERSION, NUM_SAMPLES, len(noise)))
+  f.write(struct.pack('<%dI' % len(boundaries), *boundaries))
+  data = numpy.clip(numpy.array(noise + sample_data), -32768, 32767)
+  f.write(data.astype('<i2').tostring())
+  f.close()
+
+
+if __name__ == '__main__':
+  main(sys.argv)
@@ -175,6 +175,49 @@ void TestExciter() {
   fclose(fp);
 }
 
+void TestSampleBank() {
+  SampleBankFile::Save("elements_samples.bin", kBuiltinSampleBank);
+  SampleBankFile file;
+  if (!file.Load("elements_samples.bin")) {
+    printf("Could not load sample bank\n");
+    return;
+  }
+  
+  Exciter builtin;
+  Exciter mapped;
+  builtin.Init();
+  mapped.Init();
+  mapped.set_sample_bank(&file.bank());
+  
+  size_t mismatches = 0;
+  for (int model = EXCITER_MODEL_GRANULAR_SAMPLE_PLAYER;
+       model <= EXCITER_MODEL_SAMPLE_PLAYER; ++model) {
+    for (uint32_t i = 0; i < ::kSampleRate; i += kAudioBlockSize) {
+      float parameter = static_cast<float>(i) / ::kSampleRate;
+      uint8_t flags = EXCITER_FLAG_GATE;
+      if (i % (::kSampleRate / 4) == 0) flags |= EXCITER_FLAG_RISING_EDGE;
+      float a[kAudioBlockSize];
+      float b[kAudioBlockSize];
+      Exciter* e[2] = { &builtin, &mapped };
+      for (int j = 0; j < 2; ++j) {
+        e[j]->set_model(static_cast<ExciterModel>(model));
+        e[j]->set_parameter(parameter);
+        e[j]->set_timbre(0.5f);
+        e[j]->set_signature(0.3f);
+      }
+      // Both exciters must see the same random numbers.
+      uint32_t state = Random::state();
+      builtin.Process(flags, a, kAudioBlockSize);
+      Random::Seed(state);
+      mapped.Process(flags, b, kAudioBlockSize);
+      for (size_t j = 0; j < kAudioBlockSize; ++j) {
+        mismatches += a[j] != b[j];
+      }
+    }
+  }
+  printf("Sample bank: %lu mismatches\n", mismatches);
+}
+
 void TestVoice() {
   FILE* fp = fopen("elements_voice.wav", "wb");
   write_wav_header(fp, ::kSampleRate * 20, 4);
@@ -494,6 +537,7 @@ void TestFilterAccuracy() {
 int main(void) {
   _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
   // TestFilterAccuracy();
+  // TestSampleBank();
   TestPart();
   // TestExciter();
   // TestResonator();
@@ -0,0 +1,93 @@
+// Copyright 2011 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Drum pattern at one position of the drum map.
+
+#include "grids/drum_pattern.h"
+
+#include <avr/pgmspace.h>
+
+#include "avrlib/op.h"
+
+#include "grids/resources.h"
+
+namespace grids {
+
+using namespace avrlib;
+
+static const prog_uint8_t* drum_map[5][5] = {
+  { node_10, node_8, node_0, node_9, node_11 },
+  { node_15, node_7, node_13, node_12, node_6 },
+  { node_18, node_14, node_4, node_5, node_3 },
+  { node_23, node_16, node_21, node_1, node_2 },
+  { node_24, node_19, node_17, node_20, node_22 },
+};
+
+void DrumPattern::Interpolate(uint8_t x, uint8_t y) {
+  uint8_t i = x >> 6;
+  uint8_t j = y >> 6;
+  const prog_uint8_t* a_map = drum_map[i][j];
+  const prog_uint8_t* b_map = drum_map[i + 1][j];
+  const prog_uint8_t* c_map = drum_map[i][j + 1];
+  const prog_uint8_t* d_map = drum_map[i + 1][j + 1];
+  uint8_t x_balance = x << 2;
+  uint8_t y_balance = y << 2;
+  for (uint8_t offset = 0; offset < kNumParts * kStepsPerPattern; ++offset) {
+    uint8_t a = pgm_read_byte(a_map + offset);
+    uint8_t b = pgm_read_byte(b_map + offset);
+    uint8_t c = pgm_read_byte(c_map + offset);
+    uint8_t d = pgm_read_byte(d_map + offset);
+    level_[offset] = U8Mix(
+        U8Mix(a, b, x_balance),
+        U8Mix(c, d, x_balance),
+        y_balance);
+  }
+  x_ = x;
+  y_ = y;
+}
+
+uint8_t DrumPattern::Evaluate(
+    uint8_t step,
+    const uint8_t* density,
+    const uint8_t* perturbation) const {
+  uint8_t instrument_mask = 1;
+  uint8_t triggers = 0;
+  uint8_t accents = 0;
+  const uint8_t* level = &level_[step];
+  for (uint8_t i = 0; i < kNumParts; ++i) {
+    uint8_t l = *level;
+    if (l < 255 - perturbation[i]) {
+      l += perturbation[i];
+    } else {
+      // The sequencer from Anushri uses a weird clipping rule here. Comment
+      // this line to reproduce its behavior.
+      l = 255;
+    }
+    uint8_t threshold = ~density[i];
+    if (l > threshold) {
+      if (l > 192) {
+        accents |= instrument_mask;
+      }
+      triggers |= instrument_mask;
+    }
+    instrument_mask <<= 1;
+    level += kStepsPerPattern;
+  }
+  return triggers | (accents << 3);
+}
+
+}  // namespace grids
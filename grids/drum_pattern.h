@@ -0,0 +1,84 @@
+// Copyright 2011 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Drum pattern at one position of the drum map.
+//
+// The levels of the 3 parts over the 32 steps are interpolated from the 4
+// surrounding nodes of the map once, when the position changes, instead of at
+// every step. Evaluating a step is then just a comparison of the 3 levels with
+// the density thresholds.
+//
+// This class has no dependency on the hardware, so that the host tools
+// evaluate the patterns exactly as the firmware does.
+
+#ifndef GRIDS_DRUM_PATTERN_H_
+#define GRIDS_DRUM_PATTERN_H_
+
+#include "avrlib/base.h"
+
+namespace grids {
+
+const uint8_t kNumParts = 3;
+const uint8_t kStepsPerPattern = 32;
+
+class DrumPattern {
+ public:
+  DrumPattern() { }
+  ~DrumPattern() { }
+
+  void Init(uint8_t x, uint8_t y) {
+    Interpolate(x, y);
+  }
+
+  // Interpolates the levels for the position (x, y) of the map, unless they
+  // have already been computed for this position.
+  inline void Update(uint8_t x, uint8_t y) {
+    if (x != x_ || y != y_) {
+      Interpolate(x, y);
+    }
+  }
+
+  // Returns the parts triggered at a step in bits 0 to 2, and the parts
+  // accented in bits 3 to 5. The level of each part is raised by its
+  // perturbation, then compared with the complement of its density.
+  uint8_t Evaluate(
+      uint8_t step,
+      const uint8_t* density,
+      const uint8_t* perturbation) const;
+
+  inline uint8_t level(uint8_t part, uint8_t step) const {
+    return level_[part * kStepsPerPattern + step];
+  }
+  inline uint8_t x() const { return x_; }
+  inline uint8_t y() const { return y_; }
+
+ private:
+  void Interpolate(uint8_t x, uint8_t y);
+
+  uint8_t x_;
+  uint8_t y_;
+
+  // Same layout as the nodes: all the steps of the first part, then all the
+  // steps of the second part...
+  uint8_t level_[kNumParts * kStepsPerPattern];
+
+  DISALLOW_COPY_AND_ASSIGN(DrumPattern);
+};
+
+}  // namespace grids
+
+#endif // GRIDS_DRUM_PATTERN_H_
@@ -291,6 +291,7 @@ void ScanPots() {
     settings->density[0] = ~adc.Read8(ADC_CHANNEL_BD_DENSITY_CV);
     settings->density[1] = ~adc.Read8(ADC_CHANNEL_SD_DENSITY_CV);
     settings->density[2] = ~adc.Read8(ADC_CHANNEL_HH_DENSITY_CV);
+    pattern_generator.UpdateDrumPattern();
   } else {
     for (uint8_t i = 0; i < 8; ++i) {
       int16_t value = adc.Read8(i);
@@ -60,40 +60,15 @@ uint8_t PatternGenerator::part_perturbation_[kNumParts];
 /* static */
 PatternGeneratorSettings PatternGenerator::settings_;
 
+/* static */
+DrumPattern PatternGenerator::drum_pattern_;
+
 /* static */
 uint8_t PatternGenerator::factory_testing_;
 
 /* extern */
 PatternGenerator pattern_generator;
 
-static const prog_uint8_t* drum_map[5][5] = {
-  { node_10, node_8, node_0, node_9, node_11 },
-  { node_15, node_7, node_13, node_12, node_6 },
-  { node_18, node_14, node_4, node_5, node_3 },
-  { node_23, node_16, node_21, node_1, node_2 },
-  { node_24, node_19, node_17, node_20, node_22 },
-};
-
-/* static */
-uint8_t PatternGenerator::ReadDrumMap(
-    uint8_t step,
-    uint8_t instrument,
-    uint8_t x,
-    uint8_t y) {
-  uint8_t i = x >> 6;
-  uint8_t j = y >> 6;
-  const prog_uint8_t* a_map = drum_map[i][j];
-  const prog_uint8_t* b_map = drum_map[i + 1][j];
-  const prog_uint8_t* c_map = drum_map[i][j + 1];
-  const prog_uint8_t* d_map = drum_map[i + 1][j + 1];
-  uint8_t offset = (instrument * kStepsPerPattern) + step;
-  uint8_t a = pgm_read_byte(a_map + offset);
-  uint8_t b = pgm_read_byte(b_map + offset);
-  uint8_t c = pgm_read_byte(c_map + offset);
-  uint8_t d = pgm_read_byte(d_map + offset);
-  return U8Mix(U8Mix(a, b, x << 2), U8Mix(c, d, x << 2), y << 2);
-}
-
 /* static */
 void PatternGenerator::EvaluateDrums() {
   // At the beginning of a pattern, decide on perturbation levels.
@@ -105,28 +80,12 @@ void PatternGenerator::EvaluateDrums() {
     }
   }
   
-  uint8_t instrument_mask = 1;
-  uint8_t x = settings_.options.drums.x;
-  uint8_t y = settings_.options.drums.y;
-  uint8_t accent_bits = 0;
-  for (uint8_t i = 0; i < kNumParts; ++i) {
-    uint8_t level = ReadDrumMap(step_, i, x, y);
-    if (level < 255 - part_perturbation_[i]) {
-      level += part_perturbation_[i];
-    } else {
-      // The sequencer from Anushri uses a weird clipping rule here. Comment
-      // this line to reproduce its behavior.
-      level = 255;
-    }
-    uint8_t threshold = ~settings_.density[i];
-    if (level > threshold) {
-      if (level > 192) {
-        accent_bits |= instrument_mask;
-      }
-      state_ |= instrument_mask;
-    }
-    instrument_mask <<= 1;
-  }
+  uint8_t bits = drum_pattern_.Evaluate(
+      step_,
+      settings_.density,
+      part_perturbation_);
+  uint8_t accent_bits = bits >> 3;
+  state_ |= bits & 0x07;
   if (output_clock()) {
     state_ |= accent_bits ? OUTPUT_BIT_COMMON : 0;
     state_ |= step_ == 0 ? OUTPUT_BIT_RESET : 0;
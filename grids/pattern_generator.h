@@ -31,13 +31,12 @@
 #include "avrlib/base.h"
 #include "avrlib/random.h"
 
+#include "grids/drum_pattern.h"
 #include "grids/hardware_config.h"
 
 namespace grids {
 
-const uint8_t kNumParts = 3;
 const uint8_t kPulsesPerStep = 3;  // 24 ppqn ; 8 steps per quarter note.
-const uint8_t kStepsPerPattern = 32;
 const uint8_t kPulseDuration = 8;  // 8 ticks of the main clock.
 
 struct DrumsSettings {
@@ -121,6 +120,7 @@ class PatternGenerator {
   static inline void Init() {
     LoadSettings();
     Reset();
+    drum_pattern_.Init(settings_.options.drums.x, settings_.options.drums.y);
   }
 
   static inline void Reset() {
@@ -207,6 +207,14 @@ class PatternGenerator {
     return &settings_;
   }
   
+  // To be called after the settings have been modified. Interpolates the
+  // drum pattern if x or y have moved - outside of the clock interrupt. A step
+  // evaluated by the interrupt during the update may mix levels from the old
+  // and new positions, as if x and y had been moved right before it.
+  static inline void UpdateDrumPattern() {
+    drum_pattern_.Update(settings_.options.drums.x, settings_.options.drums.y);
+  }
+  
   static bool on_first_beat() { return first_beat_; }
   static bool on_beat() { return beat_; }
   static bool factory_testing() { return factory_testing_ < 5; }
@@ -232,12 +240,6 @@ class PatternGenerator {
   static void Evaluate();
   static void EvaluateEuclidean();
   static void EvaluateDrums();
-  
-  static uint8_t ReadDrumMap(
-      uint8_t step,
-      uint8_t instrument,
-      uint8_t x,
-      uint8_t y);
 
   static Options options_;
   
@@ -255,6 +257,7 @@ class PatternGenerator {
   static uint8_t factory_testing_;
   
   static PatternGeneratorSettings settings_;
+  static DrumPattern drum_pattern_;
   
   DISALLOW_COPY_AND_ASSIGN(PatternGenerator);
 };
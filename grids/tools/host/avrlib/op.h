@@ -0,0 +1,42 @@
+// Copyright 2011 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Host replacement for avrlib/op.h: C versions of the arithmetic routines
+// written in AVR assembly in the firmware, with the same rounding.
+
+#ifndef GRIDS_TOOLS_HOST_AVRLIB_OP_H_
+#define GRIDS_TOOLS_HOST_AVRLIB_OP_H_
+
+#include "avrlib/base.h"
+
+namespace avrlib {
+
+static inline uint8_t U8Mix(uint8_t a, uint8_t b, uint8_t balance) {
+  return (a * (255 - balance) + b * balance) >> 8;
+}
+
+static inline uint16_t U8U8Mul(uint8_t a, uint8_t b) {
+  return a * b;
+}
+
+static inline uint8_t U8U8MulShift8(uint8_t a, uint8_t b) {
+  return (a * b) >> 8;
+}
+
+}  // namespace avrlib
+
+#endif  // GRIDS_TOOLS_HOST_AVRLIB_OP_H_
@@ -0,0 +1,82 @@
+// Copyright 2011 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Sweeps the drum map and prints the pattern at each position.
+//
+// Usage: pattern_exporter [increment] [bd density] [sd density] [hh density]
+//
+// x and y go from 0 to 255 by the given increment (default: 1, every
+// position of the map). For each position, one line per part is printed:
+//   <x> <y> <part> <level of step 0> ... <level of step 31>
+// When the densities (0 to 255, as set by the knobs) are given, the triggers
+// are printed instead of the levels, as evaluated by the firmware without
+// randomness:
+//   <x> <y> <part> <X: accent, x: trigger, .: rest for each step>
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "grids/drum_pattern.h"
+
+using namespace grids;
+
+int main(int argc, char** argv) {
+  int increment = argc >= 2 ? atoi(argv[1]) : 1;
+  if (increment < 1 || increment > 255) {
+    fprintf(stderr, "Increment must be between 1 and 255\n");
+    return 1;
+  }
+  
+  bool triggers = argc >= 5;
+  uint8_t density[kNumParts];
+  uint8_t perturbation[kNumParts] = { 0, 0, 0 };
+  for (uint8_t i = 0; i < kNumParts; ++i) {
+    density[i] = triggers ? atoi(argv[2 + i]) : 0;
+  }
+  
+  static DrumPattern pattern;
+  pattern.Init(0, 0);
+  for (int x = 0; x < 256; x += increment) {
+    for (int y = 0; y < 256; y += increment) {
+      pattern.Update(x, y);
+      for (uint8_t part = 0; part < kNumParts; ++part) {
+        printf("%d %d %d ", x, y, part);
+        if (triggers) {
+          char steps[kStepsPerPattern + 1];
+          for (uint8_t step = 0; step < kStepsPerPattern; ++step) {
+            uint8_t bits = pattern.Evaluate(step, density, perturbation);
+            if (bits & (8 << part)) {
+              steps[step] = 'X';
+            } else if (bits & (1 << part)) {
+              steps[step] = 'x';
+            } else {
+              steps[step] = '.';
+            }
+          }
+          steps[kStepsPerPattern] = '\0';
+          printf("%s\n", steps);
+        } else {
+          for (uint8_t step = 0; step < kStepsPerPattern; ++step) {
+            printf(step == kStepsPerPattern - 1 ? "%d\n" : "%d ",
+                   pattern.level(part, step));
+          }
+        }
+      }
+    }
+  }
+  return 0;
+}
@@ -28,6 +28,7 @@
 
 #include "peaks/drums/bass_drum.h"
 
+#include <algorithm>
 #include <cstdio>
 
 #include "stmlib/utils/dsp.h"
@@ -64,11 +65,15 @@ void BassDrum::Init() {
   lp_state_ = 0;
 }
 
+void BassDrum::Trigger() {
+  pulse_up_.Trigger(12 * 32768 * 0.7);
+  pulse_down_.Trigger(-19662 * 0.7);
+  attack_fm_.Trigger(18000);
+}
+
 int16_t BassDrum::ProcessSingleSample(uint8_t control) {
   if (control & CONTROL_GATE_RISING) {
-    pulse_up_.Trigger(12 * 32768 * 0.7);
-    pulse_down_.Trigger(-19662 * 0.7);
-    attack_fm_.Trigger(18000);
+    Trigger();
   }
   int32_t excitation = 0;
   excitation += pulse_up_.Process();
@@ -84,4 +89,56 @@ int16_t BassDrum::ProcessSingleSample(uint8_t control) {
   return output;
 }
 
+void BassDrum::Process(const uint8_t* control, int16_t* out, size_t size) {
+  int32_t excitation[kMaxDrumBlockSize];
+  int32_t scratch[kMaxDrumBlockSize];
+  while (size) {
+    if (*control & CONTROL_GATE_RISING) {
+      Trigger();
+    }
+    // Render everything up to the next trigger.
+    size_t n = 1;
+    while (n < size && n < kMaxDrumBlockSize &&
+           !(control[n] & CONTROL_GATE_RISING)) {
+      ++n;
+    }
+    
+    // The DC offset is added for as long as the down pulse is pending.
+    size_t down_pending = pulse_down_.counter();
+    size_t fm_pending = attack_fm_.counter() ? attack_fm_.counter() - 1 : 0;
+    pulse_up_.Process(excitation, n);
+    pulse_down_.Process(scratch, n);
+    for (size_t i = 0; i < n; ++i) {
+      excitation[i] += (i < down_pending ? 16384 : 0) + scratch[i];
+    }
+    attack_fm_.Process(scratch, n);
+    
+    // The pitch is raised until the attack FM pulse fires.
+    size_t boosted = std::min(n, fm_pending);
+    if (boosted) {
+      resonator_.set_frequency(frequency_ + (17 << 7));
+      resonator_.Process(excitation, scratch, boosted);
+    }
+    if (boosted < n) {
+      resonator_.set_frequency(frequency_);
+      resonator_.Process(excitation + boosted, scratch + boosted, n - boosted);
+    }
+    
+    int32_t lp_state = lp_state_;
+    const int32_t lp_coefficient = lp_coefficient_;
+    for (size_t i = 0; i < n; ++i) {
+      int32_t resonator_output = (excitation[i] >> 4) + scratch[i];
+      lp_state += (resonator_output - lp_state) * lp_coefficient >> 15;
+      int32_t output = lp_state;
+      CLIP(output);
+      out[i] = output;
+    }
+    lp_state_ = lp_state;
+    
+    control += n;
+    out += n;
+    size -= n;
+  }
+}
+
 }  // namespace peaks
@@ -45,6 +45,7 @@ class BassDrum {
 
   void Init();
   int16_t ProcessSingleSample(uint8_t control) IN_RAM;
+  void Process(const uint8_t* control, int16_t* out, size_t size);
   
   void Configure(uint16_t* parameter, ControlMode control_mode) {
     if (control_mode == CONTROL_MODE_HALF) {
@@ -84,6 +85,8 @@ class BassDrum {
   }
 
  private:
+  void Trigger();
+
   Excitation pulse_up_;
   Excitation pulse_down_;
   Excitation attack_fm_;
@@ -31,8 +31,14 @@
 
 #include "stmlib/stmlib.h"
 
+#include <algorithm>
+
 namespace peaks {
 
+// Maximum number of samples rendered at once by the block versions of the
+// drum models. Larger blocks are split.
+const size_t kMaxDrumBlockSize = 32;
+
 class Excitation {
  public:
   Excitation() { }
@@ -62,6 +68,11 @@ class Excitation {
     return counter_ == 0;
   }
   
+  // Number of calls to Process() before the excitation pulse is fired.
+  inline int32_t counter() const {
+    return counter_;
+  }
+  
   inline int32_t Process() {
     state_ = (state_ * decay_ >> 12);
     if (counter_ > 0) {
@@ -73,7 +84,48 @@ class Excitation {
     return level_ < 0 ? -state_ : state_;
   }
   
+  // Block version of Process(). The samples before and after the pulse are
+  // a plain exponential decay.
+  inline void Process(int32_t* out, size_t size) {
+    while (size) {
+      if (counter_ == 1) {
+        *out++ = Process();
+        --size;
+      } else if (counter_ > 1) {
+        size_t n = std::min(size, static_cast<size_t>(counter_ - 1));
+        Decay(out, n);
+        counter_ -= n;
+        out += n;
+        size -= n;
+      } else {
+        Decay(out, size);
+        size = 0;
+      }
+    }
+  }
+  
  private:
+  inline void Decay(int32_t* out, size_t size) {
+    int32_t state = state_;
+    if (state == 0) {
+      std::fill(&out[0], &out[size], 0);
+      return;
+    }
+    const uint32_t decay = decay_;
+    if (level_ < 0) {
+      while (size--) {
+        state = (state * decay >> 12);
+        *out++ = -state;
+      }
+    } else {
+      while (size--) {
+        state = (state * decay >> 12);
+        *out++ = state;
+      }
+    }
+    state_ = state;
+  }
+
   uint32_t delay_;
   uint32_t decay_;
   int32_t counter_;
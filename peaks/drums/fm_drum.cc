@@ -42,6 +42,7 @@ void FmDrum::Init() {
   fm_envelope_phase_ = 0xffffffff;
   am_envelope_phase_ = 0xffffffff;
   previous_sample_ = 0;
+  sample_counter_ = 0;
 }
 
 static const uint16_t kHighestNote = 128 * 128;
@@ -132,7 +133,18 @@ uint32_t FmDrum::ComputePhaseIncrement(int16_t midi_pitch) {
 void FmDrum::FillBuffer(
     InputBuffer* input_buffer,
     OutputBuffer* output_buffer) {
-  uint8_t size = kBlockSize;
+  uint8_t control[kBlockSize];
+  int16_t out[kBlockSize];
+  for (uint8_t i = 0; i < kBlockSize; ++i) {
+    control[i] = input_buffer->ImmediateRead();
+  }
+  Process(control, out, kBlockSize);
+  for (uint8_t i = 0; i < kBlockSize; ++i) {
+    output_buffer->Overwrite(out[i]);
+  }
+}
+
+void FmDrum::Process(const uint8_t* control, int16_t* out, size_t size) {
   uint32_t am_envelope_increment = ComputeEnvelopeIncrement(am_decay_);
   uint32_t fm_envelope_increment = ComputeEnvelopeIncrement(fm_decay_);
   uint32_t phase = phase_;
@@ -140,9 +152,9 @@ void FmDrum::FillBuffer(
   uint32_t am_envelope_phase = am_envelope_phase_;
   uint32_t aux_envelope_phase = aux_envelope_phase_;
   uint32_t phase_increment = phase_increment_;
+  uint8_t sample_counter = sample_counter_;
   while (size--) {
-    uint8_t control = input_buffer->ImmediateRead();
-    if (control & CONTROL_GATE_RISING) {
+    if (*control++ & CONTROL_GATE_RISING) {
       fm_envelope_phase = 0;
       am_envelope_phase = 0;
       aux_envelope_phase = 0;
@@ -157,7 +169,8 @@ void FmDrum::FillBuffer(
     if (aux_envelope_phase < 4473924) {
       aux_envelope_phase = 0xffffffff;
     }
-    if ((size & 3) == 0) {
+    // The pitch is updated every 4 samples.
+    if ((sample_counter++ & 3) == 3) {
       uint32_t aux_envelope = 65535 - Interpolate824(
           lut_env_expo, aux_envelope_phase);
       uint32_t fm_envelope = 65535 - Interpolate824(
@@ -188,8 +201,9 @@ void FmDrum::FillBuffer(
       mix = Mix(mix, overdriven, overdrive_);
     }
     previous_sample_ = mix;
-    output_buffer->Overwrite(mix);
+    *out++ = mix;
   }
+  sample_counter_ = sample_counter;
   phase_ = phase;
   fm_envelope_phase_ = fm_envelope_phase;
   am_envelope_phase_ = am_envelope_phase;
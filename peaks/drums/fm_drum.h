@@ -42,6 +42,7 @@ class FmDrum {
   
   void Init();
   void FillBuffer(InputBuffer* input_buffer, OutputBuffer* output_buffer);
+  void Process(const uint8_t* control, int16_t* out, size_t size);
   void Morph(uint16_t x, uint16_t y);
   void Configure(uint16_t* parameter, ControlMode control_mode) {
     if (control_mode == CONTROL_MODE_HALF) {
@@ -105,6 +106,7 @@ class FmDrum {
   uint32_t am_envelope_phase_;
   uint32_t aux_envelope_phase_;
   uint32_t phase_increment_;
+  uint8_t sample_counter_;
 
   DISALLOW_COPY_AND_ASSIGN(FmDrum);
 };
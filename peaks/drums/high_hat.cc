@@ -39,6 +39,10 @@ namespace peaks {
 
 using namespace stmlib;
 
+static const uint32_t kMetallicNoiseIncrements[] = {
+  48318382, 71582788, 37044092, 54313440, 66214079, 93952409
+};
+
 void HighHat::Init() {
   noise_.Init();
   noise_.set_frequency(105 << 7);  // 8kHz
@@ -60,20 +64,8 @@ int16_t HighHat::ProcessSingleSample(uint8_t control) {
     vca_envelope_.Trigger(32768 * 15);
   }
   
-  phase_[0] += 48318382;
-  phase_[1] += 71582788;
-  phase_[2] += 37044092;
-  phase_[3] += 54313440;
-  phase_[4] += 66214079;
-  phase_[5] += 93952409;
-
-  int16_t noise = 0;
-  noise += phase_[0] >> 31;
-  noise += phase_[1] >> 31;
-  noise += phase_[2] >> 31;
-  noise += phase_[3] >> 31;
-  noise += phase_[4] >> 31;
-  noise += phase_[5] >> 31;
+  int32_t noise;
+  RenderMetallicNoise(phase_, kMetallicNoiseIncrements, &noise, 1);
   noise <<= 12;
   
   // Run the SVF at the double of the original sample rate for stability.
@@ -99,4 +91,53 @@ int16_t HighHat::ProcessSingleSample(uint8_t control) {
   return hh;
 }
 
+void HighHat::Process(const uint8_t* control, int16_t* out, size_t size) {
+  // The SVFs run at twice the sample rate: their input is written twice.
+  int32_t oversampled[kMaxDrumBlockSize * 2];
+  int32_t noise[kMaxDrumBlockSize];
+  int32_t envelope[kMaxDrumBlockSize];
+  while (size) {
+    if (*control & CONTROL_GATE_RISING) {
+      vca_envelope_.Trigger(32768 * 15);
+    }
+    size_t n = 1;
+    while (n < size && n < kMaxDrumBlockSize &&
+           !(control[n] & CONTROL_GATE_RISING)) {
+      ++n;
+    }
+    
+    RenderMetallicNoise(phase_, kMetallicNoiseIncrements, noise, n);
+    for (size_t i = 0; i < n; ++i) {
+      oversampled[2 * i] = oversampled[2 * i + 1] = noise[i] << 12;
+    }
+    noise_.Process(oversampled, oversampled, 2 * n);
+    vca_envelope_.Process(envelope, n);
+    
+    for (size_t i = 0; i < n; ++i) {
+      int32_t filtered_noise = oversampled[2 * i] + oversampled[2 * i + 1];
+      // The 808-style VCA amplifies only the positive section of the signal.
+      if (filtered_noise < 0) {
+        filtered_noise = 0;
+      } else if (filtered_noise > 32767) {
+        filtered_noise = 32767;
+      }
+      int32_t vca_noise = (envelope[i] >> 4) * filtered_noise >> 14;
+      CLIP(vca_noise);
+      oversampled[2 * i] = oversampled[2 * i + 1] = vca_noise;
+    }
+    vca_coloration_.Process(oversampled, oversampled, 2 * n);
+    
+    for (size_t i = 0; i < n; ++i) {
+      int32_t hh = oversampled[2 * i] + oversampled[2 * i + 1];
+      hh <<= 1;
+      CLIP(hh);
+      out[i] = hh;
+    }
+    
+    control += n;
+    out += n;
+    size -= n;
+  }
+}
+
 }  // namespace peaks
@@ -33,6 +33,7 @@
 
 #include "peaks/drums/svf.h"
 #include "peaks/drums/excitation.h"
+#include "peaks/drums/metallic_noise.h"
 
 #include "peaks/gate_processor.h"
 
@@ -45,6 +46,7 @@ class HighHat {
 
   void Init();
   int16_t ProcessSingleSample(uint8_t control) IN_RAM;
+  void Process(const uint8_t* control, int16_t* out, size_t size);
   void Configure(uint16_t* parameter, ControlMode control_mode) { }
   
  private:
@@ -52,7 +54,7 @@ class HighHat {
   Svf vca_coloration_;
   Excitation vca_envelope_;
   
-  uint32_t phase_[6];
+  uint32_t phase_[kNumMetallicOscillators];
 
   DISALLOW_COPY_AND_ASSIGN(HighHat);
 };
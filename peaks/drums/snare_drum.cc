@@ -68,12 +68,16 @@ void SnareDrum::Init() {
   set_frequency(0);
 }
 
+void SnareDrum::Trigger() {
+  excitation_1_up_.Trigger(15 * 32768);
+  excitation_1_down_.Trigger(-1 * 32768);
+  excitation_2_.Trigger(13107);
+  excitation_noise_.Trigger(snappy_);
+}
+
 int16_t SnareDrum::ProcessSingleSample(uint8_t control) {
   if (control & CONTROL_GATE_RISING) {
-    excitation_1_up_.Trigger(15 * 32768);
-    excitation_1_down_.Trigger(-1 * 32768);
-    excitation_2_.Trigger(13107);
-    excitation_noise_.Trigger(snappy_);
+    Trigger();
   }
   
   int32_t excitation_1 = 0;
@@ -99,4 +103,68 @@ int16_t SnareDrum::ProcessSingleSample(uint8_t control) {
   return sd;
 }
 
+void SnareDrum::Process(const uint8_t* control, int16_t* out, size_t size) {
+  int32_t excitation[kMaxDrumBlockSize];
+  int32_t body_1[kMaxDrumBlockSize];
+  int32_t body_2[kMaxDrumBlockSize];
+  int32_t noise[kMaxDrumBlockSize];
+  int32_t scratch[kMaxDrumBlockSize];
+  while (size) {
+    if (*control & CONTROL_GATE_RISING) {
+      Trigger();
+    }
+    // Render everything up to the next trigger.
+    size_t n = 1;
+    while (n < size && n < kMaxDrumBlockSize &&
+           !(control[n] & CONTROL_GATE_RISING)) {
+      ++n;
+    }
+    
+    // The DC offsets are added until the delayed pulses fire.
+    int32_t counter = excitation_1_down_.counter();
+    size_t pending = counter ? counter - 1 : 0;
+    excitation_1_up_.Process(excitation, n);
+    excitation_1_down_.Process(scratch, n);
+    for (size_t i = 0; i < n; ++i) {
+      excitation[i] += scratch[i] + (i < pending ? 2621 : 0);
+    }
+    body_1_.Process(excitation, body_1, n);
+    for (size_t i = 0; i < n; ++i) {
+      body_1[i] += excitation[i] >> 4;
+    }
+    
+    counter = excitation_2_.counter();
+    pending = counter ? counter - 1 : 0;
+    excitation_2_.Process(excitation, n);
+    for (size_t i = 0; i < n; ++i) {
+      excitation[i] += i < pending ? 13107 : 0;
+    }
+    body_2_.Process(excitation, body_2, n);
+    for (size_t i = 0; i < n; ++i) {
+      body_2[i] += excitation[i] >> 4;
+    }
+    
+    for (size_t i = 0; i < n; ++i) {
+      scratch[i] = Random::GetSample();
+    }
+    noise_.Process(scratch, noise, n);
+    excitation_noise_.Process(scratch, n);
+    
+    const int32_t gain_1 = gain_1_;
+    const int32_t gain_2 = gain_2_;
+    for (size_t i = 0; i < n; ++i) {
+      int32_t sd = 0;
+      sd += body_1[i] * gain_1 >> 15;
+      sd += body_2[i] * gain_2 >> 15;
+      sd += scratch[i] * noise[i] >> 15;
+      CLIP(sd);
+      out[i] = sd;
+    }
+    
+    control += n;
+    out += n;
+    size -= n;
+  }
+}
+
 }  // namespace peaks
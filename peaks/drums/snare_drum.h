@@ -47,6 +47,7 @@ class SnareDrum {
 
   void Init();
   int16_t ProcessSingleSample(uint8_t control) IN_RAM;
+  void Process(const uint8_t* control, int16_t* out, size_t size);
   
   void Configure(uint16_t* parameter, ControlMode control_mode) {
     if (control_mode == CONTROL_MODE_HALF) {
@@ -91,6 +92,8 @@ class SnareDrum {
   }
 
  private:
+  void Trigger();
+
   Excitation excitation_1_up_;
   Excitation excitation_1_down_;
   Excitation excitation_2_;
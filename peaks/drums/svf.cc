@@ -71,5 +71,34 @@ int32_t Svf::Process(int32_t in) {
   return mode_ == SVF_MODE_BP ? bp_ : (mode_ == SVF_MODE_HP ? hp : lp_);
 }
 
+void Svf::Process(const int32_t* in, int32_t* out, size_t size) {
+  if (dirty_) {
+    f_ = Interpolate824(lut_svf_cutoff, frequency_ << 17);
+    damp_ = Interpolate824(lut_svf_damp, resonance_ << 17);
+    dirty_ = false;
+  }
+  const int32_t punch = punch_;
+  const SvfMode mode = mode_;
+  int32_t lp = lp_;
+  int32_t bp = bp_;
+  while (size--) {
+    int32_t f = f_;
+    int32_t damp = damp_;
+    if (punch) {
+      int32_t punch_signal = lp > 4096 ? lp : 2048;
+      f += ((punch_signal >> 4) * punch) >> 9;
+      damp += ((punch_signal - 2048) >> 3);
+    }
+    int32_t notch = *in++ - (bp * damp >> 15);
+    lp += f * bp >> 15;
+    CLIP(lp)
+    int32_t hp = notch - lp;
+    bp += f * hp >> 15;
+    CLIP(bp)
+    *out++ = mode == SVF_MODE_BP ? bp : (mode == SVF_MODE_HP ? hp : lp);
+  }
+  lp_ = lp;
+  bp_ = bp;
+}
 
 }  // namespace peaks
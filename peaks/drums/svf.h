@@ -65,6 +65,7 @@ class Svf {
   }
 
   int32_t Process(int32_t sample) IN_RAM;
+  void Process(const int32_t* in, int32_t* out, size_t size);
   
  private:
   bool dirty_;
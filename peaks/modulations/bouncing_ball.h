@@ -83,6 +83,12 @@ class BouncingBall {
     }
     return position_ >> 15;
   }
+
+  void Process(const uint8_t* control, int16_t* out, size_t size) {
+    while (size--) {
+      *out++ = ProcessSingleSample(*control++);
+    }
+  }
   
   inline void set_gravity(uint16_t gravity) {
     gravity_ = stmlib::Interpolate88(lut_gravity, gravity);
@@ -73,16 +73,26 @@ void Lfo::set_shape_parameter_preset(uint16_t value) {
 void Lfo::FillBuffer(
     InputBuffer* input_buffer,
     OutputBuffer* output_buffer) {
+  uint8_t control[kBlockSize];
+  int16_t out[kBlockSize];
+  for (uint8_t i = 0; i < kBlockSize; ++i) {
+    control[i] = input_buffer->ImmediateRead();
+  }
+  Process(control, out, kBlockSize);
+  for (uint8_t i = 0; i < kBlockSize; ++i) {
+    output_buffer->Overwrite(out[i]);
+  }
+}
+
+void Lfo::Process(const uint8_t* control, int16_t* out, size_t size) {
   if (!sync_) {
     int32_t a = lut_lfo_increments[rate_ >> 8];
     int32_t b = lut_lfo_increments[(rate_ >> 8) + 1];
     phase_increment_ = a + (((b - a) >> 1) * (rate_ & 0xff) >> 7);
   }
-  uint8_t size = kBlockSize;  
   while (size--) {
     ++sync_counter_;
-    uint8_t control = input_buffer->ImmediateRead();
-    if (control & CONTROL_GATE_RISING) {
+    if (*control++ & CONTROL_GATE_RISING) {
       bool reset_phase = true;
       if (sync_) {
         if (sync_counter_ < kSyncCounterMaxTime) {
@@ -106,7 +116,7 @@ void Lfo::FillBuffer(
     }
     phase_ += phase_increment_;
     int32_t sample = (this->*compute_sample_fn_table_[shape_])();
-    output_buffer->Overwrite(sample * level_ >> 15);
+    *out++ = sample * level_ >> 15;
   }
 }
 
@@ -54,6 +54,7 @@ class Lfo {
   
   void Init();
   void FillBuffer(InputBuffer* input_buffer, OutputBuffer* output_buffer);
+  void Process(const uint8_t* control, int16_t* out, size_t size);
   
   void Configure(uint16_t* parameter, ControlMode control_mode) {
     if (control_mode == CONTROL_MODE_HALF) {
@@ -89,6 +89,12 @@ class MiniSequencer {
     }
     return steps_[step_];
   }
+
+  void Process(const uint8_t* control, int16_t* out, size_t size) {
+    while (size--) {
+      *out++ = ProcessSingleSample(*control++);
+    }
+  }
   
  private:
   uint8_t num_steps_;
@@ -28,12 +28,15 @@
 
 #include "peaks/modulations/multistage_envelope.h"
 
+#include <algorithm>
+
 #include "stmlib/utils/dsp.h"
 
 #include "peaks/resources.h"
 
 namespace peaks {
 
+using namespace std;
 using namespace stmlib;
 
 void MultistageEnvelope::Init() {
@@ -82,4 +85,55 @@ int16_t MultistageEnvelope::ProcessSingleSample(uint8_t control) {
   return value_;
 }
 
+void MultistageEnvelope::Process(
+    const uint8_t* control,
+    int16_t* out,
+    size_t size) {
+  // Edges and segment transitions go through ProcessSingleSample; the samples
+  // in-between are rendered by runs, without re-evaluating the segment state
+  // for each of them.
+  while (size) {
+    uint8_t c = *control++;
+    *out++ = ProcessSingleSample(c);
+    --size;
+    if (c & (CONTROL_GATE_RISING | CONTROL_GATE_FALLING)) {
+      continue;
+    }
+    size_t run = 0;
+    while (run < size && control[run] == c) {
+      ++run;
+    }
+    run = RenderSegment(out, run);
+    control += run;
+    out += run;
+    size -= run;
+  }
+}
+
+size_t MultistageEnvelope::RenderSegment(int16_t* out, size_t size) {
+  // The increment computed by the last call to ProcessSingleSample is valid
+  // until the end of the segment, as long as the control flags don't change.
+  const uint32_t increment = phase_increment_;
+  if (increment == 0) {
+    fill(&out[0], &out[size], value_);
+    return size;
+  }
+  
+  const uint16_t* table = lookup_table_table[LUT_ENV_LINEAR + shape_[segment_]];
+  int32_t a = start_value_;
+  int32_t b = level_[segment_ + 1];
+  uint32_t phase = phase_;
+  int16_t value = value_;
+  size_t n = 0;
+  while (n < size && phase >= increment) {
+    uint16_t t = Interpolate824(table, phase);
+    value = a + ((b - a) * (t >> 1) >> 15);
+    phase += increment;
+    out[n++] = value;
+  }
+  phase_ = phase;
+  value_ = value;
+  return n;
+}
+
 }  // namespace peaks
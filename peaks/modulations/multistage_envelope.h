@@ -51,6 +51,7 @@ class MultistageEnvelope {
   
   void Init();
   int16_t ProcessSingleSample(uint8_t control);
+  void Process(const uint8_t* control, int16_t* out, size_t size);
   
   void Configure(uint16_t* parameter, ControlMode control_mode) {
     if (control_mode == CONTROL_MODE_HALF) {
@@ -293,6 +294,8 @@ class MultistageEnvelope {
   }
   
  private:
+  size_t RenderSegment(int16_t* out, size_t size);
+
   int16_t level_[kMaxNumSegments];
   uint16_t time_[kMaxNumSegments];
   EnvelopeShape shape_[kMaxNumSegments];
@@ -65,6 +65,30 @@ size_t voice_digits[] = {
 void NumberStation::FillBuffer(
     InputBuffer* input_buffer,
     OutputBuffer* output_buffer) {
+  uint8_t control[kBlockSize];
+  int16_t out[kBlockSize];
+  for (uint8_t i = 0; i < kBlockSize; ++i) {
+    control[i] = input_buffer->ImmediateRead();
+  }
+  ProcessBlock(control, out);
+  for (uint8_t i = 0; i < kBlockSize; ++i) {
+    output_buffer->Overwrite(out[i]);
+  }
+}
+
+void NumberStation::Process(
+    const uint8_t* control,
+    int16_t* out,
+    size_t size) {
+  while (size >= kBlockSize) {
+    ProcessBlock(control, out);
+    control += kBlockSize;
+    out += kBlockSize;
+    size -= kBlockSize;
+  }
+}
+
+void NumberStation::ProcessBlock(const uint8_t* control, int16_t* out) {
   uint32_t phase_increment;
 
   if (voice_) {
@@ -90,8 +114,8 @@ void NumberStation::FillBuffer(
   uint8_t size = kBlockSize / kDownsample;
   while (size--) {
     for (uint8_t i = 0; i < kDownsample; ++i) {
-      uint8_t control = input_buffer->ImmediateRead();
-      if (control & CONTROL_GATE_RISING) {
+      uint8_t gate_flags = *control++;
+      if (gate_flags & CONTROL_GATE_RISING) {
         uint16_t random = Random::GetSample();
         if (random < transition_probability_) {
           digit_ = random >> 2;
@@ -101,7 +125,7 @@ void NumberStation::FillBuffer(
           phase_ = voice_digits[digit_] << 16;
         }
       }
-      if (control & CONTROL_GATE) {
+      if (gate_flags & CONTROL_GATE) {
         tone_amplitude_ += (32767 - tone_amplitude_) >> 6;
       } else {
         tone_amplitude_ -= tone_amplitude_ >> 6;
@@ -169,13 +193,13 @@ void NumberStation::FillBuffer(
     int32_t outer_sample ;
     outer_sample = lp_.Process(
         hp_.Process((inner_sample + previous_inner_sample_) >> 1));
-    output_buffer->Overwrite((previous_outer_sample_ + outer_sample) >> 1);
-    output_buffer->Overwrite(outer_sample);
+    *out++ = (previous_outer_sample_ + outer_sample) >> 1;
+    *out++ = outer_sample;
     previous_outer_sample_ = outer_sample;
 
     outer_sample = lp_.Process(hp_.Process(inner_sample));
-    output_buffer->Overwrite((previous_outer_sample_ + outer_sample) >> 1);
-    output_buffer->Overwrite(outer_sample);
+    *out++ = (previous_outer_sample_ + outer_sample) >> 1;
+    *out++ = outer_sample;
     previous_outer_sample_ = outer_sample;
 
     previous_inner_sample_ = inner_sample;
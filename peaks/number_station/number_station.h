@@ -43,6 +43,9 @@ class NumberStation {
   
   void Init();
   void FillBuffer(InputBuffer* input_buffer, OutputBuffer* output_buffer);
+  // The drift of the carrier is updated once every kBlockSize samples, so
+  // size must be a multiple of kBlockSize.
+  void Process(const uint8_t* control, int16_t* out, size_t size);
   
   void Configure(uint16_t* parameter, ControlMode control_mode) {
     if (control_mode == CONTROL_MODE_HALF) {
@@ -84,6 +87,8 @@ class NumberStation {
   inline bool gate() const { return gate_; }
   
  private:
+  void ProcessBlock(const uint8_t* control, int16_t* out);
+
   uint16_t tone_;
   uint16_t pitch_shift_;
   uint16_t transition_probability_;
@@ -39,12 +39,14 @@ using namespace std;
   { &Processors::ClassName ## Init, \
     NULL, \
     &Processors::ClassName ## FillBuffer, \
+    &Processors::ClassName ## Process, \
     &Processors::ClassName ## Configure },
 
 #define REGISTER_UNBUFFERED_PROCESSOR(ClassName) \
   { &Processors::ClassName ## Init, \
     &Processors::ClassName ## ProcessSingleSample, \
     NULL, \
+    &Processors::ClassName ## Process, \
     &Processors::ClassName ## Configure },
 
 /* static */
@@ -72,6 +72,9 @@ enum ProcessorFunction {
   void ClassName ## FillBuffer() { \
     variable.FillBuffer(&input_buffer_, &output_buffer_); \
   } \
+  void ClassName ## Process(const uint8_t* c, int16_t* o, size_t n) { \
+    variable.Process(c, o, n); \
+  } \
   void ClassName ## Configure(uint16_t* p, ControlMode control_mode) { \
     variable.Configure(p, control_mode); \
   } \
@@ -84,6 +87,9 @@ enum ProcessorFunction {
   int16_t ClassName ## ProcessSingleSample(uint8_t control) { \
     return variable.ProcessSingleSample(control); \
   } \
+  void ClassName ## Process(const uint8_t* c, int16_t* o, size_t n) { \
+    variable.Process(c, o, n); \
+  } \
   void ClassName ## Configure(uint16_t* p, ControlMode control_mode) { \
     variable.Configure(p, control_mode); \
   } \
@@ -100,12 +106,14 @@ class Processors {
   typedef void (Processors::*InitFn)(); 
   typedef int16_t (Processors::*ProcessSingleSampleFn)(uint8_t); 
   typedef void (Processors::*FillBufferFn)(); 
+  typedef void (Processors::*ProcessFn)(const uint8_t*, int16_t*, size_t);
   typedef void (Processors::*ConfigureFn)(uint16_t*, ControlMode);
   
   struct ProcessorCallbacks {
     InitFn init_fn;
     ProcessSingleSampleFn process_single_sample;
     FillBufferFn fill_buffer;
+    ProcessFn process;
     ConfigureFn configure;
   };
   
@@ -144,6 +152,15 @@ class Processors {
     }
   }
   
+  // Renders size samples at once, dispatching to the current function only
+  // once. This bypasses the input/output buffers used by the sample-by-sample
+  // interface above (and their kBlockSize samples of latency), so the two
+  // interfaces should not be mixed on the same processor. size must be a
+  // multiple of kBlockSize.
+  inline void Process(const uint8_t* control, int16_t* out, size_t size) {
+    (this->*callbacks_.process)(control, out, size);
+  }
+  
   inline bool Buffer() {
     if (callbacks_.fill_buffer) {
       if (output_buffer_.writable() < kBlockSize) {
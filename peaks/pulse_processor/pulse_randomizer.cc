@@ -75,7 +75,29 @@ void PulseRandomizer::FillBuffer(
     uint8_t control = input_buffer->ImmediateRead();
     new_pulse |= control & CONTROL_GATE_RISING;
   }
-    
+  int16_t output = Tick(new_pulse);
+  for (uint8_t i = 0; i < kBlockSize; ++i) {
+    output_buffer->Overwrite(output);
+  }
+}
+
+void PulseRandomizer::Process(
+    const uint8_t* control,
+    int16_t* out,
+    size_t size) {
+  while (size >= kBlockSize) {
+    bool new_pulse = false;
+    for (uint8_t i = 0; i < kBlockSize; ++i) {
+      new_pulse |= control[i] & CONTROL_GATE_RISING;
+    }
+    std::fill(&out[0], &out[kBlockSize], Tick(new_pulse));
+    control += kBlockSize;
+    out += kBlockSize;
+    size -= kBlockSize;
+  }
+}
+
+int16_t PulseRandomizer::Tick(bool new_pulse) {
   if ((Random::GetWord() >> 16) > acceptance_probability_) {
     // Randomly ignore incoming pulses.
     new_pulse = false;
@@ -112,11 +134,7 @@ void PulseRandomizer::FillBuffer(
     }
   }
     
-  uint16_t output = retrig_counter_ > 6 ? 20480 : 0;
-    
-  for (uint8_t i = 0; i < kBlockSize; ++i) {
-    output_buffer->Overwrite(output);
-  }
+  return retrig_counter_ > 6 ? 20480 : 0;
 }
 
 }  // namespace peaks
@@ -76,7 +76,26 @@ void PulseShaper::FillBuffer(
     uint8_t control = input_buffer->ImmediateRead();
     new_pulse |= control & CONTROL_GATE_RISING;
   }
-    
+  int16_t output = Tick(new_pulse);
+  for (uint8_t i = 0; i < kBlockSize; ++i) {
+    output_buffer->Overwrite(output);
+  }
+}
+
+void PulseShaper::Process(const uint8_t* control, int16_t* out, size_t size) {
+  while (size >= kBlockSize) {
+    bool new_pulse = false;
+    for (uint8_t i = 0; i < kBlockSize; ++i) {
+      new_pulse |= control[i] & CONTROL_GATE_RISING;
+    }
+    std::fill(&out[0], &out[kBlockSize], Tick(new_pulse));
+    control += kBlockSize;
+    out += kBlockSize;
+    size -= kBlockSize;
+  }
+}
+
+int16_t PulseShaper::Tick(bool new_pulse) {
   uint8_t num_pulses = 0;
   for (uint8_t i = 0; i < kPulseBufferSize; ++i) {
     Pulse& p = pulse_buffer_[i];
@@ -128,11 +147,7 @@ void PulseShaper::FillBuffer(
   if (retrig_counter_) {
     --retrig_counter_;
   }
-  uint16_t output = num_pulses > 0 && !retrig_counter_ ? 20480 : 0;
-    
-  for (uint8_t i = 0; i < kBlockSize; ++i) {
-    output_buffer->Overwrite(output);
-  }
+  return num_pulses > 0 && !retrig_counter_ ? 20480 : 0;
 }
 
 }  // namespace peaks
@@ -52,6 +52,9 @@ class PulseShaper {
   
   void Init();
   void FillBuffer(InputBuffer* input_buffer, OutputBuffer* output_buffer);
+  // The pulse counters are clocked once every kBlockSize samples, so size
+  // must be a multiple of kBlockSize.
+  void Process(const uint8_t* control, int16_t* out, size_t size);
   
   void Configure(uint16_t* parameter, ControlMode control_mode) {
     if (control_mode == CONTROL_MODE_HALF) {
@@ -84,6 +87,7 @@ class PulseShaper {
   }
   
  private:
+  int16_t Tick(bool new_pulse);
   uint16_t delay() const;
   uint16_t duration() const;
   uint16_t initial_delay() const;
@@ -17,8 +17,12 @@
 #include <cstdio>
 #include <cstring>
 #include <cstdlib>
+#include <vector>
+
+#include "stmlib/utils/random.h"
 
 #include "peaks/processors.h"
+#include "peaks/tools/processor_timeline.h"
 
 using namespace peaks;
 using namespace stmlib;
@@ -55,7 +59,58 @@ void write_wav_header(FILE* fp, int num_samples, int num_channels) {
   fwrite(&l, 4, 1, fp);
 }
 
+void TestTimeline() {
+  const size_t kDuration = kSampleRate * 60;
+  std::vector<uint8_t> control(kDuration);
+  uint32_t period = kSampleRate / 3;
+  for (size_t i = 0; i < kDuration; ++i) {
+    control[i] = i % period < (period / 4) ? CONTROL_GATE : 0;
+    if (i % period == 0) {
+      control[i] |= CONTROL_GATE_RISING;
+    }
+  }
+  
+  ProcessorFunction functions[] = {
+    PROCESSOR_FUNCTION_NUMBER_STATION,
+    PROCESSOR_FUNCTION_MINI_SEQUENCER,
+    PROCESSOR_FUNCTION_BOUNCING_BALL,
+    PROCESSOR_FUNCTION_SNARE_DRUM,
+  };
+  for (size_t f = 0; f < sizeof(functions) / sizeof(functions[0]); ++f) {
+    Random::Seed(0x21);
+    processors[0].Init(0);
+    processors[0].set_function(functions[f]);
+    for (uint8_t i = 0; i < 4; ++i) {
+      processors[0].set_parameter(i, 12000 + i * 16000);
+    }
+    
+    // Render the whole session once, as a reference.
+    ProcessorTimeline timeline;
+    std::vector<int16_t> reference(kDuration);
+    timeline.Init(&processors[0], &control[0], kDuration, kSampleRate * 5);
+    timeline.Render(&reference[0], kDuration);
+    
+    // Then jump around and compare with the reference.
+    size_t mismatches = 0;
+    int16_t out[kBlockSize * 16];
+    for (size_t trial = 0; trial < 100; ++trial) {
+      size_t position = (rand() % (kDuration / kBlockSize)) * kBlockSize;
+      timeline.Seek(position);
+      size_t n = timeline.Render(out, kBlockSize * 16);
+      for (size_t i = 0; i < n; ++i) {
+        mismatches += out[i] != reference[position + i];
+      }
+    }
+    printf("function %d: %d checkpoints, %d mismatches\n",
+        functions[f],
+        static_cast<int>(timeline.num_checkpoints()),
+        static_cast<int>(mismatches));
+  }
+}
+
 int main(void) {
+  TestTimeline();
+  
   FILE* fp = fopen("peaks.wav", "wb");
   write_wav_header(fp, kSampleRate * 10, 1);
   processors[0].Init(1);
@@ -0,0 +1,325 @@
+// Copyright 2013 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Offline drum renderer.
+//
+// Renders a list of drum hits - for example all the variations of a sample
+// kit - as fast as the CPU allows. The hits are distributed across worker
+// processes rather than threads, since the drum models draw their noise from
+// the global stmlib::Random generator. Each hit is seeded from its own
+// parameters, so the output does not depend on the number of workers, and
+// identical hits are rendered only once.
+//
+// Usage:
+//   drum_renderer hits.txt [num_workers]
+//
+// Each line of the hit list describes one hit:
+//   <bd|sd|hh|fm> <p1> <p2> <p3> <p4> <duration in ms> <file.wav>
+// with the 4 parameters in the 0-65535 range, as with the module in full
+// (4 knobs) control mode.
+
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "stmlib/utils/random.h"
+
+#include "peaks/drums/bass_drum.h"
+#include "peaks/drums/fm_drum.h"
+#include "peaks/drums/high_hat.h"
+#include "peaks/drums/snare_drum.h"
+
+using namespace peaks;
+using namespace std;
+using namespace stmlib;
+
+const uint32_t kSampleRate = 48000;
+const size_t kRenderBlockSize = 256;
+
+enum DrumModel {
+  DRUM_MODEL_BASS_DRUM,
+  DRUM_MODEL_SNARE_DRUM,
+  DRUM_MODEL_HIGH_HAT,
+  DRUM_MODEL_FM_DRUM,
+  DRUM_MODEL_LAST
+};
+
+const char* const kDrumModelNames[DRUM_MODEL_LAST] = {
+  "bd", "sd", "hh", "fm"
+};
+
+struct DrumHit {
+  DrumModel model;
+  uint16_t parameter[4];
+  uint32_t duration;  // In samples.
+  
+  bool operator<(const DrumHit& other) const {
+    if (model != other.model) {
+      return model < other.model;
+    }
+    if (duration != other.duration) {
+      return duration < other.duration;
+    }
+    return memcmp(parameter, other.parameter, sizeof(parameter)) < 0;
+  }
+  
+  uint32_t seed() const {
+    uint32_t seed = 0x21 + model;
+    for (size_t i = 0; i < 4; ++i) {
+      seed = seed * 1664525L + 1013904223L + parameter[i];
+    }
+    return seed;
+  }
+};
+
+// One instance of each drum model, re-initialized before each hit.
+class DrumRenderer {
+ public:
+  DrumRenderer() { }
+  ~DrumRenderer() { }
+  
+  void Render(const DrumHit& hit, int16_t* out) {
+    uint16_t parameter[4];
+    copy(&hit.parameter[0], &hit.parameter[4], &parameter[0]);
+    Random::Seed(hit.seed());
+    switch (hit.model) {
+      case DRUM_MODEL_BASS_DRUM:
+        RenderHit(&bass_drum_, parameter, hit.duration, out);
+        break;
+      case DRUM_MODEL_SNARE_DRUM:
+        RenderHit(&snare_drum_, parameter, hit.duration, out);
+        break;
+      case DRUM_MODEL_HIGH_HAT:
+        RenderHit(&high_hat_, parameter, hit.duration, out);
+        break;
+      case DRUM_MODEL_FM_DRUM:
+        RenderHit(&fm_drum_, parameter, hit.duration, out);
+        break;
+      default:
+        fill(&out[0], &out[hit.duration], 0);
+        break;
+    }
+  }
+  
+ private:
+  template<typename Drum>
+  void RenderHit(Drum* drum, uint16_t* parameter, size_t size, int16_t* out) {
+    drum->Init();
+    drum->Configure(parameter, CONTROL_MODE_FULL);
+    uint8_t control[kRenderBlockSize];
+    fill(&control[0], &control[kRenderBlockSize], CONTROL_GATE);
+    control[0] |= CONTROL_GATE_RISING;
+    while (size) {
+      size_t n = min(size, kRenderBlockSize);
+      drum->Process(control, out, n);
+      control[0] = CONTROL_GATE;
+      out += n;
+      size -= n;
+    }
+  }
+  
+  BassDrum bass_drum_;
+  SnareDrum snare_drum_;
+  HighHat high_hat_;
+  FmDrum fm_drum_;
+  
+  DISALLOW_COPY_AND_ASSIGN(DrumRenderer);
+};
+
+bool ParseHitList(
+    const char* file_name,
+    vector<DrumHit>* hits,
+    vector<string>* file_names) {
+  FILE* fp = fopen(file_name, "r");
+  if (!fp) {
+    return false;
+  }
+  char line[1024];
+  size_t line_number = 0;
+  while (fgets(line, sizeof(line), fp)) {
+    ++line_number;
+    if (line[0] == '#' || line[0] == '\n') {
+      continue;
+    }
+    char model[16];
+    char wav_file_name[768];
+    unsigned int p[4];
+    unsigned int duration_ms;
+    if (sscanf(line, "%15s %u %u %u %u %u %767s",
+               model, &p[0], &p[1], &p[2], &p[3], &duration_ms,
+               wav_file_name) != 7) {
+      fprintf(stderr, "%s:%lu: syntax error\n", file_name, line_number);
+      fclose(fp);
+      return false;
+    }
+    DrumHit hit;
+    hit.model = DRUM_MODEL_LAST;
+    for (size_t i = 0; i < DRUM_MODEL_LAST; ++i) {
+      if (!strcmp(model, kDrumModelNames[i])) {
+        hit.model = static_cast<DrumModel>(i);
+      }
+    }
+    if (hit.model == DRUM_MODEL_LAST) {
+      fprintf(stderr, "%s:%lu: unknown model %s\n", file_name, line_number,
+              model);
+      fclose(fp);
+      return false;
+    }
+    for (size_t i = 0; i < 4; ++i) {
+      hit.parameter[i] = min(p[i], 65535U);
+    }
+    hit.duration = static_cast<uint64_t>(duration_ms) * kSampleRate / 1000;
+    hits->push_back(hit);
+    file_names->push_back(wav_file_name);
+  }
+  fclose(fp);
+  return true;
+}
+
+void WriteWavHeader(FILE* fp, uint32_t num_frames) {
+  uint32_t l;
+  uint16_t s;
+  
+  fwrite("RIFF", 4, 1, fp);
+  l = 36 + num_frames * 2;
+  fwrite(&l, 4, 1, fp);
+  fwrite("WAVE", 4, 1, fp);
+  
+  fwrite("fmt ", 4, 1, fp);
+  l = 16;
+  fwrite(&l, 4, 1, fp);
+  s = 1;
+  fwrite(&s, 2, 1, fp);
+  s = 1;
+  fwrite(&s, 2, 1, fp);
+  l = kSampleRate;
+  fwrite(&l, 4, 1, fp);
+  l = kSampleRate * 2;
+  fwrite(&l, 4, 1, fp);
+  s = 2;
+  fwrite(&s, 2, 1, fp);
+  s = 16;
+  fwrite(&s, 2, 1, fp);
+  
+  fwrite("data", 4, 1, fp);
+  l = num_frames * 2;
+  fwrite(&l, 4, 1, fp);
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s hits.txt [num_workers]\n", argv[0]);
+    return 1;
+  }
+  
+  vector<DrumHit> hits;
+  vector<string> file_names;
+  if (!ParseHitList(argv[1], &hits, &file_names)) {
+    fprintf(stderr, "Could not read %s\n", argv[1]);
+    return 1;
+  }
+  
+  // Identical hits share the same render.
+  map<DrumHit, size_t> cache;
+  vector<size_t> render_index(hits.size());
+  vector<DrumHit> renders;
+  vector<size_t> offset;
+  size_t total_size = 0;
+  for (size_t i = 0; i < hits.size(); ++i) {
+    map<DrumHit, size_t>::const_iterator it = cache.find(hits[i]);
+    if (it != cache.end()) {
+      render_index[i] = it->second;
+    } else {
+      render_index[i] = cache[hits[i]] = renders.size();
+      renders.push_back(hits[i]);
+      offset.push_back(total_size);
+      total_size += hits[i].duration;
+    }
+  }
+  
+  // The workers write into a shared anonymous mapping.
+  int16_t* samples = static_cast<int16_t*>(mmap(
+      NULL, max(total_size, size_t(1)) * sizeof(int16_t),
+      PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0));
+  if (samples == MAP_FAILED) {
+    fprintf(stderr, "Could not allocate %lu samples\n", total_size);
+    return 1;
+  }
+  
+  long num_workers = argc >= 3
+      ? atoi(argv[2])
+      : sysconf(_SC_NPROCESSORS_ONLN);
+  num_workers = max(1L, min(num_workers, long(renders.size())));
+  vector<pid_t> workers;
+  for (long w = 0; w < num_workers; ++w) {
+    pid_t pid = fork();
+    if (pid == 0) {
+      DrumRenderer renderer;
+      for (size_t i = w; i < renders.size(); i += num_workers) {
+        renderer.Render(renders[i], &samples[offset[i]]);
+      }
+      _exit(0);
+    } else if (pid < 0) {
+      fprintf(stderr, "Could not start worker\n");
+      return 1;
+    }
+    workers.push_back(pid);
+  }
+  bool success = true;
+  for (size_t w = 0; w < workers.size(); ++w) {
+    int status;
+    waitpid(workers[w], &status, 0);
+    success = success && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+  }
+  if (!success) {
+    fprintf(stderr, "A worker failed\n");
+    return 1;
+  }
+  
+  for (size_t i = 0; i < hits.size(); ++i) {
+    FILE* fp = fopen(file_names[i].c_str(), "wb");
+    if (!fp) {
+      fprintf(stderr, "Could not write %s\n", file_names[i].c_str());
+      success = false;
+      continue;
+    }
+    WriteWavHeader(fp, hits[i].duration);
+    fwrite(&samples[offset[render_index[i]]], sizeof(int16_t),
+           hits[i].duration, fp);
+    fclose(fp);
+  }
+  printf("%lu hits, %lu rendered, %ld workers\n",
+         hits.size(), renders.size(), num_workers);
+  return success ? 0 : 1;
+}
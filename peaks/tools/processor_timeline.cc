@@ -0,0 +1,108 @@
+// Copyright 2013 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Checkpointed offline rendering of a processor.
+
+#include "peaks/tools/processor_timeline.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "stmlib/utils/random.h"
+
+namespace peaks {
+
+using namespace std;
+using namespace stmlib;
+
+const size_t kFastForwardBlockSize = 256;
+
+void ProcessorTimeline::Init(
+    Processors* processors,
+    const uint8_t* control,
+    size_t size,
+    size_t checkpoint_interval) {
+  processors_ = processors;
+  control_ = control;
+  size_ = size - size % kBlockSize;
+  position_ = 0;
+  checkpoint_interval_ = max(
+      checkpoint_interval - checkpoint_interval % kBlockSize,
+      static_cast<size_t>(kBlockSize));
+  checkpoints_.clear();
+  SaveCheckpoint();
+}
+
+size_t ProcessorTimeline::Render(int16_t* out, size_t size) {
+  size = min(size, size_ - position_);
+  size_t rendered = 0;
+  while (rendered < size) {
+    size_t next_checkpoint = checkpoints_.size() * checkpoint_interval_;
+    if (position_ == next_checkpoint) {
+      SaveCheckpoint();
+      next_checkpoint += checkpoint_interval_;
+    }
+    size_t n = min(size - rendered, next_checkpoint - position_);
+    processors_->Process(&control_[position_], &out[rendered], n);
+    position_ += n;
+    rendered += n;
+  }
+  return rendered;
+}
+
+void ProcessorTimeline::Seek(size_t position) {
+  position = min(position, size_);
+  position -= position % kBlockSize;
+  size_t index = min(position / checkpoint_interval_, checkpoints_.size() - 1);
+  if (position < position_ || index * checkpoint_interval_ > position_) {
+    RestoreCheckpoint(index);
+  }
+  
+  int16_t scratch[kFastForwardBlockSize];
+  while (position_ < position) {
+    Render(scratch, min(position - position_, kFastForwardBlockSize));
+  }
+}
+
+void ProcessorTimeline::SaveCheckpoint() {
+  // The processors do not hold pointers to their own members, so a copy of
+  // their bytes is a complete snapshot of their state.
+  checkpoints_.push_back(Checkpoint());
+  Checkpoint* checkpoint = &checkpoints_.back();
+  memcpy(checkpoint->processors, static_cast<void*>(processors_),
+         sizeof(Processors));
+  checkpoint->rng_state = Random::state();
+}
+
+void ProcessorTimeline::RestoreCheckpoint(size_t index) {
+  const Checkpoint& checkpoint = checkpoints_[index];
+  memcpy(static_cast<void*>(processors_), checkpoint.processors,
+         sizeof(Processors));
+  Random::Seed(checkpoint.rng_state);
+  position_ = index * checkpoint_interval_;
+}
+
+}  // namespace peaks
@@ -0,0 +1,98 @@
+// Copyright 2013 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Checkpointed offline rendering of a processor.
+//
+// All the generators of the module evolve only from their internal state,
+// the global random generator and the gate inputs. A snapshot of these every
+// few seconds is thus enough to jump to any point of a long render: the
+// nearest checkpoint is restored, and the processor is fast-forwarded from
+// there through the block API, instead of re-rendering from the beginning.
+//
+// Parameter changes made while rendering are captured by the next
+// checkpoint, but they are not replayed when fast-forwarding over them.
+
+#ifndef PEAKS_TOOLS_PROCESSOR_TIMELINE_H_
+#define PEAKS_TOOLS_PROCESSOR_TIMELINE_H_
+
+#include "stmlib/stmlib.h"
+
+#include <vector>
+
+#include "peaks/processors.h"
+
+namespace peaks {
+
+class ProcessorTimeline {
+ public:
+  ProcessorTimeline() { }
+  ~ProcessorTimeline() { }
+  
+  // The control stream must outlive the timeline. The checkpoint interval (in
+  // samples) is rounded to a multiple of kBlockSize. The current state of the
+  // processor is recorded as the first checkpoint.
+  void Init(
+      Processors* processors,
+      const uint8_t* control,
+      size_t size,
+      size_t checkpoint_interval);
+  
+  // Renders up to size samples from the current position, recording the
+  // checkpoints crossed for the first time. size must be a multiple of
+  // kBlockSize. Returns the number of samples rendered, which is smaller
+  // than size at the end of the control stream.
+  size_t Render(int16_t* out, size_t size);
+  
+  // Restores the state of the processor at the given position, rounded down
+  // to a multiple of kBlockSize.
+  void Seek(size_t position);
+  
+  inline size_t position() const { return position_; }
+  inline size_t size() const { return size_; }
+  inline size_t num_checkpoints() const { return checkpoints_.size(); }
+  
+ private:
+  struct Checkpoint {
+    uint8_t processors[sizeof(Processors)];
+    uint32_t rng_state;
+  };
+  
+  void SaveCheckpoint();
+  void RestoreCheckpoint(size_t index);
+  
+  Processors* processors_;
+  const uint8_t* control_;
+  size_t size_;
+  size_t position_;
+  size_t checkpoint_interval_;
+  std::vector<Checkpoint> checkpoints_;
+  
+  DISALLOW_COPY_AND_ASSIGN(ProcessorTimeline);
+};
+
+}  // namespace peaks
+
+#endif  // PEAKS_TOOLS_PROCESSOR_TIMELINE_H_
@@ -200,6 +200,10 @@ class OnsetDetector {
     return has_onset;
   }
   
+  // Smoothed onset detection function, as computed by the last call to
+  // Process.
+  inline float onset_df() const { return onset_df_; }
+  
  private:
   Compressor compressor_;
   NaiveSvf low_mid_filter_;
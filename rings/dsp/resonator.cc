@@ -42,6 +42,9 @@ using namespace stmlib;
 void Resonator::Init() {
   for (int32_t i = 0; i < kMaxModes; ++i) {
     f_[i].Init();
+    mode_active_[i] = true;
+    mode_quiet_samples_[i] = 0;
+    mode_energy_[i] = 0.0f;
   }
 
   set_frequency(220.0f / kSampleRate);
@@ -97,25 +100,98 @@ int32_t Resonator::ComputeFilters() {
   return num_modes;
 }
 
+void Resonator::UpdateActiveModes(
+    const float* in,
+    size_t size,
+    int32_t num_modes) {
+  float peak = 0.0f;
+  for (size_t i = 0; i < size; ++i) {
+    float x = fabs(in[i]);
+    if (x > peak) {
+      peak = x;
+    }
+  }
+  bool excited = peak > kModeExcitationThreshold;
+  
+  num_active_modes_[0] = num_active_modes_[1] = 0;
+  num_amplitudes_ = 0;
+  for (int32_t i = 0; i < num_modes; ++i) {
+    if (excited) {
+      mode_active_[i] = true;
+      mode_quiet_samples_[i] = 0;
+    }
+    if (mode_active_[i]) {
+      int32_t parity = i & 1;
+      active_modes_[parity][num_active_modes_[parity]++] = i;
+      num_amplitudes_ = i + 1;
+    }
+  }
+}
+
+void Resonator::RetireSilentModes(size_t size) {
+  float period = std::min(1.0f / frequency_, 16384.0f);
+  float threshold = kModeEnergyThreshold * static_cast<float>(size);
+  for (int32_t parity = 0; parity < 2; ++parity) {
+    for (int32_t j = 0; j < num_active_modes_[parity]; ++j) {
+      int32_t i = active_modes_[parity][j];
+      if (mode_energy_[i] < threshold) {
+        mode_quiet_samples_[i] += size;
+        if (mode_quiet_samples_[i] >= period) {
+          mode_active_[i] = false;
+        }
+      } else {
+        mode_quiet_samples_[i] = 0;
+      }
+      mode_energy_[i] = 0.0f;
+    }
+  }
+}
+
 void Resonator::Process(const float* in, float* out, float* aux, size_t size) {
   int32_t num_modes = ComputeFilters();
+  UpdateActiveModes(in, size, num_modes);
+  
+  const int32_t num_amplitudes = num_amplitudes_;
+  const int32_t num_odd = num_active_modes_[0];
+  const int32_t num_even = num_active_modes_[1];
+  const int32_t* odd_modes = active_modes_[0];
+  const int32_t* even_modes = active_modes_[1];
+  float* energy = mode_energy_;
+  float* amplitude = amplitude_;
   
   ParameterInterpolator position(&previous_position_, position_, size);
-  while (size--) {
+  for (size_t t = 0; t < size; ++t) {
     CosineOscillator amplitudes;
     amplitudes.Init<COSINE_OSCILLATOR_APPROXIMATE>(position.Next());
     
-    float input = *in++ * 0.125f;
+    // The pickup amplitudes are a recurrence, so they are computed for all
+    // modes up to the last active one - this is much cheaper than the
+    // filters themselves.
+    amplitudes.Start();
+    for (int32_t i = 0; i < num_amplitudes; ++i) {
+      amplitude[i] = amplitudes.Next();
+    }
+    
+    float input = in[t] * 0.125f;
     float odd = 0.0f;
     float even = 0.0f;
-    amplitudes.Start();
-    for (int32_t i = 0; i < num_modes;) {
-      odd += amplitudes.Next() * f_[i++].Process<FILTER_MODE_BAND_PASS>(input);
-      even += amplitudes.Next() * f_[i++].Process<FILTER_MODE_BAND_PASS>(input);
+    for (int32_t j = 0; j < num_odd; ++j) {
+      int32_t i = odd_modes[j];
+      float s = f_[i].Process<FILTER_MODE_BAND_PASS>(input);
+      odd += amplitude[i] * s;
+      energy[i] += s * s;
     }
-    *out++ = odd;
-    *aux++ = even;
+    for (int32_t j = 0; j < num_even; ++j) {
+      int32_t i = even_modes[j];
+      float s = f_[i].Process<FILTER_MODE_BAND_PASS>(input);
+      even += amplitude[i] * s;
+      energy[i] += s * s;
+    }
+    out[t] = odd;
+    aux[t] = even;
   }
+  
+  RetireSilentModes(size);
 }
 
 }  // namespace rings
@@ -41,6 +41,13 @@ namespace rings {
 
 const int32_t kMaxModes = 64;
 
+// A mode whose mean squared output stays below this level for more than a
+// period of the fundamental is removed from the active set.
+const float kModeEnergyThreshold = 1.0e-10f;
+
+// Any input above this level re-admits all the modes.
+const float kModeExcitationThreshold = 1.0e-4f;
+
 class Resonator {
  public:
   Resonator() { }
@@ -80,6 +87,9 @@ class Resonator {
   
  private:
   int32_t ComputeFilters();
+  void UpdateActiveModes(const float* in, size_t size, int32_t num_modes);
+  void RetireSilentModes(size_t size);
+  
   float frequency_;
   float structure_;
   float brightness_;
@@ -91,6 +101,16 @@ class Resonator {
   
   stmlib::Svf f_[kMaxModes];
   
+  // Compacted lists of the modes still ringing, split by parity since odd
+  // and even modes are sent to different outputs.
+  int32_t active_modes_[2][kMaxModes / 2];
+  int32_t num_active_modes_[2];
+  int32_t num_amplitudes_;
+  bool mode_active_[kMaxModes];
+  int32_t mode_quiet_samples_[kMaxModes];
+  float mode_energy_[kMaxModes];
+  float amplitude_[kMaxModes];
+  
   DISALLOW_COPY_AND_ASSIGN(Resonator);
 };
 
@@ -127,6 +127,108 @@ void String::ProcessInternal(
       1.0f - Interpolate(lut_svf_shift, damping_cutoff, 1.0f),
       size);
   
+  if (src_ratio == 1.0f) {
+    // Common case: one string sample per output sample. Everything that
+    // does not depend on the feedback path is computed in separate passes
+    // over the block, leaving only the delay line read/write and the
+    // damping filters in the serial loop.
+    float main_delay[kMaxBlockSize];
+    float comb_delay[kMaxBlockSize];
+    float stretch_point[kMaxBlockSize];
+    float ap_gain[kMaxBlockSize];
+    float bridge_curving[kMaxBlockSize];
+    float ac_blocking_amount[kMaxBlockSize];
+    
+    while (size) {
+      size_t n = min(size, kMaxBlockSize);
+      
+      // Delay times.
+      for (size_t i = 0; i < n; ++i) {
+        float delay = delay_modulation.Next();
+        comb_delay[i] = delay * position_modulation.Next();
+#ifndef MIC_W
+        delay *= damping_compensation_modulation.Next();  // IIR delay.
+#endif  // MIC_W
+        main_delay[i] = delay - 1.0f; // FIR delay.
+      }
+      
+      // Dispersion coefficients and noise. The bridge curving term depends
+      // on the string output, so only its scale is precomputed here.
+      if (enable_dispersion) {
+        for (size_t i = 0; i < n; ++i) {
+          float noise = 2.0f * Random::GetFloat() - 1.0f;
+          noise *= 1.0f / (0.2f + noise_filter);
+          dispersion_noise_ += noise_filter * (noise - dispersion_noise_);
+          
+          float dispersion = dispersion_modulation.Next();
+          stretch_point[i] = dispersion <= 0.0f
+              ? 0.0f
+              : dispersion * (2.0f - dispersion) * 0.475f;
+          float noise_amount = dispersion > 0.75f
+              ? 4.0f * (dispersion - 0.75f)
+              : 0.0f;
+          float curving = dispersion < 0.0f ? -dispersion : 0.0f;
+          noise_amount = noise_amount * noise_amount * 0.025f;
+          ac_blocking_amount[i] = curving;
+          curving = curving * curving * 0.01f;
+          ap_gain[i] = -0.618f * dispersion / (0.15f + fabs(dispersion));
+          
+          float delay = main_delay[i];
+          bridge_curving[i] = delay * curving;
+          main_delay[i] = delay * (1.0f + dispersion_noise_ * noise_amount);
+        }
+      }
+      
+      // Feedback loop.
+      for (size_t i = 0; i < n; ++i) {
+        float s = 0.0f;
+        if (enable_dispersion) {
+          float delay = main_delay[i] - curved_bridge_ * bridge_curving[i];
+          float ap_delay = delay * stretch_point[i];
+          float string_delay = delay - ap_delay;
+          if (ap_delay >= 4.0f && string_delay >= 4.0f) {
+            s = string_.ReadHermite(string_delay);
+            s = stretch_.Allpass(s, ap_delay, ap_gain[i]);
+          } else {
+            s = string_.ReadHermite(delay);
+          }
+          float s_ac = s;
+          dc_blocker_.Process(&s_ac, 1);
+          s += ac_blocking_amount[i] * (s_ac - s);
+          
+          float value = fabs(s) - 0.025f;
+          float sign = s > 0.0f ? 1.0f : -1.5f;
+          curved_bridge_ = (fabs(value) + value) * sign;
+        } else {
+          s = string_.ReadHermite(main_delay[i]);
+        }
+        
+        s += in[i];
+        s = fir_damping_filter_.Process(s);
+#ifndef MIC_W
+        s = iir_damping_filter_.Process<FILTER_MODE_LOW_PASS>(s);
+#endif  // MIC_W
+        string_.Write(s);
+        
+        out_sample_[1] = out_sample_[0];
+        aux_sample_[1] = aux_sample_[0];
+        
+        out_sample_[0] = s;
+        aux_sample_[0] = string_.Read(comb_delay[i]);
+        out[i] += out_sample_[0];
+        aux[i] += aux_sample_[0];
+      }
+      
+      in += n;
+      out += n;
+      aux += n;
+      size -= n;
+    }
+    return;
+  }
+  
+  // Low pitches: the string runs at a lower rate than the output, and is
+  // upsampled with a linear interpolator.
   while (size--) {
     src_phase_ += src_ratio;
     if (src_phase_ > 1.0f) {
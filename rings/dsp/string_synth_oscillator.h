@@ -39,6 +39,8 @@ namespace rings {
 
 using namespace stmlib;
 
+const float kOscillatorSilenceThreshold = 1.0e-6f;
+
 enum OscillatorShape {
   OSCILLATOR_SHAPE_BRIGHT_SQUARE,
   OSCILLATOR_SHAPE_SQUARE,
@@ -79,6 +81,18 @@ class StringSynthOscillator {
         return;
       }
     }
+
+    // Most registrations leave some harmonics silent, and the voices of
+    // decayed groups are silent too: skip them altogether instead of running
+    // the polyblep at zero gain. The phase of a silent oscillator is
+    // irrelevant.
+    if (target_gain + target_gain_saw == 0.0f &&
+        gain_ + gain_saw_ < kOscillatorSilenceThreshold) {
+      gain_ = 0.0f;
+      gain_saw_ = 0.0f;
+      phase_increment_ = target_increment;
+      return;
+    }
     float phase = phase_;
     ParameterInterpolator phase_increment(
         &phase_increment_,
@@ -272,30 +272,35 @@ void StringSynthPart::ProcessFormantFilter(
     float* out,
     float* aux,
     size_t size) {
-  for (size_t i = 0; i < size; ++i) {
-    filter_in_buffer_[i] = out[i] + aux[i];
-  }
-  fill(&out[0], &out[size], 0.0f);
-  fill(&aux[0], &aux[size], 0.0f);
-
   vowel *= (kFormantTableSize - 1.001f);
   MAKE_INTEGRAL_FRACTIONAL(vowel);
   
+  float gain_out[kNumFormants];
+  float gain_aux[kNumFormants];
   for (int32_t i = 0; i < kNumFormants; ++i) {
     float a = formants[vowel_integral][i];
     float b = formants[vowel_integral + 1][i];
     float f = a + (b - a) * vowel_fractional;
     f *= shift;
     formant_filter_[i].set_f_q<FREQUENCY_DIRTY>(f / kSampleRate, resonance);
-    formant_filter_[i].Process<FILTER_MODE_BAND_PASS>(
-        filter_in_buffer_,
-        filter_out_buffer_,
-        size);
     const float pan = i * 0.3f + 0.2f;
-    for (size_t j = 0; j < size; ++j) {
-      out[j] += filter_out_buffer_[j] * pan * 0.5f;
-      aux[j] += filter_out_buffer_[j] * (1.0f - pan) * 0.5f;
+    gain_out[i] = pan * 0.5f;
+    gain_aux[i] = (1.0f - pan) * 0.5f;
+  }
+  
+  // All formants are run side by side in a single pass, instead of going
+  // through an intermediate buffer once per formant.
+  for (size_t j = 0; j < size; ++j) {
+    const float in = out[j] + aux[j];
+    float l = 0.0f;
+    float r = 0.0f;
+    for (int32_t i = 0; i < kNumFormants; ++i) {
+      float s = formant_filter_[i].Process<FILTER_MODE_BAND_PASS>(in);
+      l += s * gain_out[i];
+      r += s * gain_aux[i];
     }
+    out[j] = l;
+    aux[j] = r;
   }
 }
 
@@ -355,6 +360,16 @@ void StringSynthPart::Process(
       notes[i].amplitude = n >= 0.0f && n <= 17.0f ? 1.0f : 0.7f;
     }
 
+    // The per-note amplitudes of all harmonics are the outer product of the
+    // chord note levels and the registration.
+    float amplitudes[kMaxChordSize][kNumHarmonics * 2];
+    for (int32_t chord_note = 0; chord_note < chord_size; ++chord_note) {
+      const float level = notes[chord_note].amplitude;
+      for (int32_t i = 0; i < kNumHarmonics * 2; ++i) {
+        amplitudes[chord_note][i] = level * harmonics[i];
+      }
+    }
+
     for (int32_t chord_note = 0; chord_note < chord_size; ++chord_note) {
       float note = 0.0f;
       note += group_[group].tonic;
@@ -362,24 +377,20 @@ void StringSynthPart::Process(
       note += performance_state.fm;
       note += notes[chord_note].note;
       
-      float amplitudes[kNumHarmonics * 2];
-      for (int32_t i = 0; i < kNumHarmonics * 2; ++i) {
-        amplitudes[i] = notes[chord_note].amplitude * harmonics[i];
-      }
-      
       // Fold truncated harmonics.
+      float* a = amplitudes[chord_note];
       size_t num_harmonics = polyphony_ >= 2 && chord_note < 2
           ? kNumHarmonics - 1
           : kNumHarmonics;
       for (int32_t i = num_harmonics; i < kNumHarmonics; ++i) {
-        amplitudes[2 * (num_harmonics - 1)] += amplitudes[2 * i];
-        amplitudes[2 * (num_harmonics - 1) + 1] += amplitudes[2 * i + 1];
+        a[2 * (num_harmonics - 1)] += a[2 * i];
+        a[2 * (num_harmonics - 1) + 1] += a[2 * i + 1];
       }
 
       float frequency = SemitonesToRatio(note - 69.0f) * a3;
       voice_[group * chord_size + chord_note].Render(
           frequency,
-          amplitudes,
+          a,
           num_harmonics,
           (group + chord_note) & 1 ? out : aux,
           size);
@@ -128,9 +128,6 @@ class StringSynthPart {
   
   NoteFilter note_filter_;
   
-  float filter_in_buffer_[kMaxBlockSize];
-  float filter_out_buffer_[kMaxBlockSize];
-  
   bool clear_fx_;
   
   DISALLOW_COPY_AND_ASSIGN(StringSynthPart);
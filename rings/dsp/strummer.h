@@ -87,6 +87,10 @@ class Strummer {
     }
     previous_note_ = performance_state->note;
   }
+  
+  inline const OnsetDetector& onset_detector() const {
+    return onset_detector_;
+  }
 
  private:
   float previous_note_;
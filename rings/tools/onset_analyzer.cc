@@ -0,0 +1,426 @@
+// Copyright 2015 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Offline onset analysis.
+//
+// Runs the strummer/onset detector of the module over whole files, as fast as
+// the CPU allows, and saves the strum times and the onset detection function
+// in a compact binary file (.ons). Several files are analyzed in parallel.
+// The .ons files can then be replayed into PerformanceState to render the
+// resonator offline, with exactly the strums the module would have produced.
+//
+// Usage:
+//   onset_analyzer analyze a.wav [b.wav ...]   (writes a.ons, b.ons...)
+//   onset_analyzer render a.ons out.wav [model] [note]
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "rings/dsp/dsp.h"
+#include "rings/dsp/part.h"
+#include "rings/dsp/patch.h"
+#include "rings/dsp/performance_state.h"
+#include "rings/dsp/strummer.h"
+
+using namespace rings;
+using namespace std;
+using namespace stmlib;
+
+const uint32_t kOnsetTrackMagic = FourCC<'O', 'N', 'S', 'T'>::value;
+const uint16_t kOnsetTrackVersion = 1;
+
+// The file starts with this header, followed by:
+// - num_blocks uint16_t values: the ODF sampled at the end of each block,
+//   divided by odf_scale.
+// - num_onsets uint32_t values: the sample position of each strum.
+struct OnsetTrackHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t block_size;
+  uint32_t sample_rate;
+  uint32_t num_blocks;
+  uint32_t num_onsets;
+  float odf_scale;
+};
+
+struct OnsetTrack {
+  uint32_t sample_rate;
+  vector<float> odf;
+  vector<uint32_t> onsets;
+};
+
+// Replays the strums of an onset track, block by block.
+class OnsetTrackPlayer {
+ public:
+  OnsetTrackPlayer(const OnsetTrack& track) : track_(track) {
+    position_ = 0;
+    next_onset_ = 0;
+  }
+
+  void Process(size_t size, PerformanceState* performance_state) {
+    uint32_t end = position_ + size;
+    bool strum = false;
+    while (next_onset_ < track_.onsets.size() &&
+           track_.onsets[next_onset_] < end) {
+      strum = true;
+      ++next_onset_;
+    }
+    performance_state->strum = strum;
+    position_ = end;
+  }
+
+ private:
+  const OnsetTrack& track_;
+  uint32_t position_;
+  size_t next_onset_;
+};
+
+bool ReadWav(const char* file_name, vector<float>* samples, uint32_t* sr) {
+  FILE* fp = fopen(file_name, "rb");
+  if (!fp) {
+    return false;
+  }
+
+  char riff[12];
+  if (fread(riff, 1, 12, fp) != 12 ||
+      memcmp(riff, "RIFF", 4) || memcmp(riff + 8, "WAVE", 4)) {
+    fclose(fp);
+    return false;
+  }
+
+  uint16_t num_channels = 0;
+  uint16_t bits_per_sample = 0;
+  bool success = false;
+  while (true) {
+    char chunk_id[4];
+    uint32_t chunk_size;
+    if (fread(chunk_id, 1, 4, fp) != 4 ||
+        fread(&chunk_size, 4, 1, fp) != 1) {
+      break;
+    }
+    if (!memcmp(chunk_id, "fmt ", 4)) {
+      uint8_t fmt[16];
+      if (chunk_size < 16 || fread(fmt, 1, 16, fp) != 16) {
+        break;
+      }
+      memcpy(&num_channels, &fmt[2], 2);
+      memcpy(sr, &fmt[4], 4);
+      memcpy(&bits_per_sample, &fmt[14], 2);
+      fseek(fp, chunk_size - 16 + (chunk_size & 1), SEEK_CUR);
+    } else if (!memcmp(chunk_id, "data", 4)) {
+      if (bits_per_sample != 16 || !num_channels) {
+        break;
+      }
+      size_t num_frames = chunk_size / (2 * num_channels);
+      vector<int16_t> data(num_frames * num_channels);
+      num_frames = fread(&data[0], 2 * num_channels, num_frames, fp);
+
+      // The module has a mono input. Mix down everything.
+      samples->resize(num_frames);
+      float scale = 1.0f / (32768.0f * num_channels);
+      for (size_t i = 0; i < num_frames; ++i) {
+        int32_t sum = 0;
+        for (size_t j = 0; j < num_channels; ++j) {
+          sum += data[i * num_channels + j];
+        }
+        (*samples)[i] = static_cast<float>(sum) * scale;
+      }
+      success = true;
+      break;
+    } else {
+      fseek(fp, chunk_size + (chunk_size & 1), SEEK_CUR);
+    }
+  }
+  fclose(fp);
+  return success;
+}
+
+void Analyze(const vector<float>& samples, OnsetTrack* track) {
+  Strummer strummer;
+  strummer.Init(0.01f, kSampleRate / kMaxBlockSize);
+
+  // Same configuration as when the module has a signal patched in its input,
+  // and nothing in its STRUM and V/OCT inputs.
+  PerformanceState performance_state;
+  performance_state.strum = false;
+  performance_state.internal_exciter = false;
+  performance_state.internal_strum = true;
+  performance_state.internal_note = true;
+  performance_state.note = 0.0f;
+
+  size_t num_blocks = samples.size() / kMaxBlockSize;
+  track->odf.resize(num_blocks);
+  track->onsets.clear();
+  for (size_t i = 0; i < num_blocks; ++i) {
+    const float* in = &samples[i * kMaxBlockSize];
+    strummer.Process(in, kMaxBlockSize, &performance_state);
+    track->odf[i] = strummer.onset_detector().onset_df();
+    if (performance_state.strum) {
+      track->onsets.push_back(i * kMaxBlockSize);
+    }
+  }
+}
+
+bool WriteTrack(const char* file_name, const OnsetTrack& track) {
+  FILE* fp = fopen(file_name, "wb");
+  if (!fp) {
+    return false;
+  }
+  float peak = 0.0f;
+  for (size_t i = 0; i < track.odf.size(); ++i) {
+    peak = max(peak, fabs(track.odf[i]));
+  }
+
+  OnsetTrackHeader header;
+  header.magic = kOnsetTrackMagic;
+  header.version = kOnsetTrackVersion;
+  header.block_size = kMaxBlockSize;
+  header.sample_rate = track.sample_rate;
+  header.num_blocks = track.odf.size();
+  header.num_onsets = track.onsets.size();
+  header.odf_scale = peak > 0.0f ? peak / 65535.0f : 1.0f;
+  fwrite(&header, sizeof(header), 1, fp);
+
+  vector<uint16_t> odf(track.odf.size());
+  for (size_t i = 0; i < odf.size(); ++i) {
+    float value = max(track.odf[i], 0.0f) / header.odf_scale + 0.5f;
+    odf[i] = static_cast<uint16_t>(min(value, 65535.0f));
+  }
+  if (!odf.empty()) {
+    fwrite(&odf[0], sizeof(uint16_t), odf.size(), fp);
+  }
+  if (!track.onsets.empty()) {
+    fwrite(&track.onsets[0], sizeof(uint32_t), track.onsets.size(), fp);
+  }
+  fclose(fp);
+  return true;
+}
+
+bool ReadTrack(const char* file_name, OnsetTrack* track) {
+  FILE* fp = fopen(file_name, "rb");
+  if (!fp) {
+    return false;
+  }
+  OnsetTrackHeader header;
+  bool success = fread(&header, sizeof(header), 1, fp) == 1 &&
+      header.magic == kOnsetTrackMagic &&
+      header.version == kOnsetTrackVersion;
+  if (success) {
+    vector<uint16_t> odf(header.num_blocks);
+    track->onsets.resize(header.num_onsets);
+    success = (!header.num_blocks || fread(
+        &odf[0], sizeof(uint16_t), odf.size(), fp) == odf.size()) &&
+        (!header.num_onsets || fread(
+        &track->onsets[0], sizeof(uint32_t), header.num_onsets, fp) == \
+            header.num_onsets);
+    track->sample_rate = header.sample_rate;
+    track->odf.resize(header.num_blocks);
+    for (size_t i = 0; i < odf.size(); ++i) {
+      track->odf[i] = odf[i] * header.odf_scale;
+    }
+  }
+  fclose(fp);
+  return success;
+}
+
+// Files are handed to the worker threads through a shared counter.
+struct AnalysisJob {
+  char** file_names;
+  int32_t num_files;
+  volatile int32_t next_file;
+  volatile int32_t num_errors;
+};
+
+void* AnalysisWorker(void* arg) {
+  AnalysisJob* job = static_cast<AnalysisJob*>(arg);
+  while (true) {
+    int32_t index = __sync_fetch_and_add(&job->next_file, 1);
+    if (index >= job->num_files) {
+      break;
+    }
+    const char* file_name = job->file_names[index];
+
+    vector<float> samples;
+    OnsetTrack track;
+    if (!ReadWav(file_name, &samples, &track.sample_rate)) {
+      fprintf(stderr, "%s: not a 16-bit PCM WAV file\n", file_name);
+      __sync_fetch_and_add(&job->num_errors, 1);
+      continue;
+    }
+    if (track.sample_rate != static_cast<uint32_t>(kSampleRate)) {
+      fprintf(stderr, "%s: sample rate must be %d Hz\n", file_name,
+          static_cast<int32_t>(kSampleRate));
+      __sync_fetch_and_add(&job->num_errors, 1);
+      continue;
+    }
+    Analyze(samples, &track);
+
+    string output_name(file_name);
+    size_t extension = output_name.rfind('.');
+    if (extension != string::npos) {
+      output_name.erase(extension);
+    }
+    output_name += ".ons";
+    if (!WriteTrack(output_name.c_str(), track)) {
+      fprintf(stderr, "%s: cannot write file\n", output_name.c_str());
+      __sync_fetch_and_add(&job->num_errors, 1);
+      continue;
+    }
+    printf("%s: %d onsets\n", output_name.c_str(),
+        static_cast<int32_t>(track.onsets.size()));
+  }
+  return NULL;
+}
+
+int AnalyzeFiles(char** file_names, int32_t num_files) {
+  AnalysisJob job;
+  job.file_names = file_names;
+  job.num_files = num_files;
+  job.next_file = 0;
+  job.num_errors = 0;
+
+  int32_t num_threads = static_cast<int32_t>(sysconf(_SC_NPROCESSORS_ONLN));
+  num_threads = max(1, min(num_threads, num_files));
+  vector<pthread_t> threads(num_threads);
+  for (int32_t i = 0; i < num_threads; ++i) {
+    pthread_create(&threads[i], NULL, &AnalysisWorker, &job);
+  }
+  for (int32_t i = 0; i < num_threads; ++i) {
+    pthread_join(threads[i], NULL);
+  }
+  return job.num_errors ? 1 : 0;
+}
+
+void WriteWavHeader(FILE* fp, uint32_t num_frames, uint32_t sample_rate) {
+  uint32_t l;
+  uint16_t s;
+
+  fwrite("RIFF", 4, 1, fp);
+  l = 36 + num_frames * 4;
+  fwrite(&l, 4, 1, fp);
+  fwrite("WAVE", 4, 1, fp);
+
+  fwrite("fmt ", 4, 1, fp);
+  l = 16;
+  fwrite(&l, 4, 1, fp);
+  s = 1;
+  fwrite(&s, 2, 1, fp);
+  s = 2;
+  fwrite(&s, 2, 1, fp);
+  l = sample_rate;
+  fwrite(&l, 4, 1, fp);
+  l = sample_rate * 4;
+  fwrite(&l, 4, 1, fp);
+  s = 4;
+  fwrite(&s, 2, 1, fp);
+  s = 16;
+  fwrite(&s, 2, 1, fp);
+
+  fwrite("data", 4, 1, fp);
+  l = num_frames * 4;
+  fwrite(&l, 4, 1, fp);
+}
+
+uint16_t reverb_buffer[65536];
+
+int Render(
+    const char* track_name,
+    const char* output_name,
+    ResonatorModel model,
+    float note) {
+  OnsetTrack track;
+  if (!ReadTrack(track_name, &track)) {
+    fprintf(stderr, "%s: not an onset track\n", track_name);
+    return 1;
+  }
+  FILE* fp = fopen(output_name, "wb");
+  if (!fp) {
+    fprintf(stderr, "%s: cannot write file\n", output_name);
+    return 1;
+  }
+
+  Part part;
+  part.Init(reverb_buffer);
+  part.set_polyphony(1);
+  part.set_model(model);
+
+  Patch patch;
+  patch.structure = 0.25f;
+  patch.brightness = 0.5f;
+  patch.damping = 0.7f;
+  patch.position = 0.3f;
+
+  PerformanceState performance_state;
+  performance_state.internal_exciter = true;
+  performance_state.internal_strum = false;
+  performance_state.internal_note = false;
+  performance_state.tonic = 12.0f;
+  performance_state.note = note;
+  performance_state.fm = 0.0f;
+  performance_state.chord = 0;
+
+  OnsetTrackPlayer player(track);
+  uint32_t num_frames = track.odf.size() * kMaxBlockSize;
+  WriteWavHeader(fp, num_frames, track.sample_rate);
+  for (size_t i = 0; i < track.odf.size(); ++i) {
+    float in[kMaxBlockSize];
+    float out[kMaxBlockSize];
+    float aux[kMaxBlockSize];
+    fill(&in[0], &in[kMaxBlockSize], 0.0f);
+    player.Process(kMaxBlockSize, &performance_state);
+    part.Process(performance_state, patch, in, out, aux, kMaxBlockSize);
+    for (size_t j = 0; j < kMaxBlockSize; ++j) {
+      int16_t frame[2];
+      frame[0] = Clip16(static_cast<int32_t>(out[j] * 32767.0f));
+      frame[1] = Clip16(static_cast<int32_t>(aux[j] * 32767.0f));
+      fwrite(frame, sizeof(int16_t), 2, fp);
+    }
+  }
+  fclose(fp);
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  if (argc >= 3 && !strcmp(argv[1], "analyze")) {
+    return AnalyzeFiles(&argv[2], argc - 2);
+  } else if (argc >= 4 && !strcmp(argv[1], "render")) {
+    int32_t model = argc >= 5 ? atoi(argv[4]) : RESONATOR_MODEL_MODAL;
+    float note = argc >= 6 ? atof(argv[5]) : 48.0f;
+    CONSTRAIN(model, 0, RESONATOR_MODEL_LAST - 1);
+    return Render(argv[2], argv[3], ResonatorModel(model), note);
+  }
+  fprintf(stderr, "Usage:\n");
+  fprintf(stderr, "  %s analyze file.wav [file.wav ...]\n", argv[0]);
+  fprintf(stderr, "  %s render file.ons out.wav [model] [note]\n", argv[0]);
+  return 1;
+}
@@ -104,7 +104,7 @@ int32_t Compressor::Compress(
   return -attenuation;
 }
 
-void Compressor::Process(
+inline void Compressor::ProcessSample(
     int16_t audio,
     int16_t excite,
     uint16_t* gain,
@@ -155,4 +155,23 @@ void Compressor::Process(
   *frequency = 65535;
 }
 
+void Compressor::Process(
+    int16_t audio,
+    int16_t excite,
+    uint16_t* gain,
+    uint16_t* frequency) {
+  ProcessSample(audio, excite, gain, frequency);
+}
+
+void Compressor::Process(
+    const int16_t* audio,
+    const int16_t* excite,
+    uint16_t* gain,
+    uint16_t* frequency,
+    size_t size) {
+  while (size--) {
+    ProcessSample(*audio++, *excite++, gain++, frequency++);
+  }
+}
+
 }  // namespace streams
@@ -50,6 +50,12 @@ class Compressor {
       int16_t excite,
       uint16_t* gain,
       uint16_t* frequency);
+  void Process(
+      const int16_t* audio,
+      const int16_t* excite,
+      uint16_t* gain,
+      uint16_t* frequency,
+      size_t size);
   
   void Configure(bool alternate, int32_t* parameters, int32_t* globals) {
     uint16_t attack_time;
@@ -105,6 +111,12 @@ class Compressor {
   inline int32_t gain_reduction() const { return gain_reduction_; }
   
  private:
+  void ProcessSample(
+      int16_t audio,
+      int16_t excite,
+      uint16_t* gain,
+      uint16_t* frequency);
+  
   static int32_t Log2(int32_t value);
   static int32_t Exp2(int32_t value);
   static int32_t Compress(
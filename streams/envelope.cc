@@ -57,7 +57,7 @@ void Envelope::Init() {
   decay_ = 0;
 }
 
-void Envelope::Process(
+inline void Envelope::ProcessSample(
     int16_t audio,
     int16_t excite,
     uint16_t* gain,
@@ -125,4 +125,23 @@ void Envelope::Process(
   *frequency = frequency_offset_ + (scaled * frequency_amount_ >> 15);
 }
 
+void Envelope::Process(
+    int16_t audio,
+    int16_t excite,
+    uint16_t* gain,
+    uint16_t* frequency) {
+  ProcessSample(audio, excite, gain, frequency);
+}
+
+void Envelope::Process(
+    const int16_t* audio,
+    const int16_t* excite,
+    uint16_t* gain,
+    uint16_t* frequency,
+    size_t size) {
+  while (size--) {
+    ProcessSample(*audio++, *excite++, gain++, frequency++);
+  }
+}
+
 }  // namespace streams
@@ -31,6 +31,8 @@
 
 #include "stmlib/stmlib.h"
 
+#include <algorithm>
+
 namespace streams {
 
 class FilterController {
@@ -61,6 +63,29 @@ class FilterController {
     *gain = 0;
     *frequency = f;
   }
+  
+  void Process(
+      const int16_t* audio,
+      const int16_t* excite,
+      uint16_t* gain,
+      uint16_t* frequency,
+      size_t size) {
+    std::fill(&gain[0], &gain[size], 0);
+    while (size && !settled()) {
+      Process(*audio++, *excite++, gain++, frequency++);
+      --size;
+    }
+    
+    // Once the smoothed parameters have settled, the frequency is a plain
+    // function of the EXCITE input, and this loop can be vectorized.
+    int32_t frequency_offset = frequency_offset_;
+    int32_t frequency_amount = frequency_amount_;
+    for (size_t i = 0; i < size; ++i) {
+      int32_t f = frequency_offset + (excite[i] * frequency_amount >> 14);
+      CONSTRAIN(f, 0, 65535);
+      frequency[i] = f;
+    }
+  }
 
   void Configure(bool alternate, int32_t* parameters, int32_t* globals) {
     int32_t amount = parameters[1];
@@ -71,6 +96,11 @@ class FilterController {
   }
 
  private:
+  inline bool settled() const {
+    return ((target_frequency_amount_ - frequency_amount_) >> 8) == 0 &&
+        ((target_frequency_offset_ - frequency_offset_) >> 8) == 0;
+  }
+  
   int32_t target_frequency_amount_;
   int32_t target_frequency_offset_;
   int32_t frequency_amount_;
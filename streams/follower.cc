@@ -54,7 +54,7 @@ void Follower::Init() {
   centroid_ = 0;
 }
 
-void Follower::Process(
+inline void Follower::ProcessSample(
     int16_t audio,
     int16_t excite,
     uint16_t* gain,
@@ -134,4 +134,23 @@ void Follower::Process(
   }
 }
 
+void Follower::Process(
+    int16_t audio,
+    int16_t excite,
+    uint16_t* gain,
+    uint16_t* frequency) {
+  ProcessSample(audio, excite, gain, frequency);
+}
+
+void Follower::Process(
+    const int16_t* audio,
+    const int16_t* excite,
+    uint16_t* gain,
+    uint16_t* frequency,
+    size_t size) {
+  while (size--) {
+    ProcessSample(*audio++, *excite++, gain++, frequency++);
+  }
+}
+
 }  // namespace streams
@@ -50,6 +50,12 @@ class Follower {
       int16_t excite,
       uint16_t* gain,
       uint16_t* frequency);
+  void Process(
+      const int16_t* audio,
+      const int16_t* excite,
+      uint16_t* gain,
+      uint16_t* frequency,
+      size_t size);
 
   void Configure(bool alternate, int32_t* parameters, int32_t* globals) {
     uint16_t attack_time;
@@ -101,6 +107,12 @@ class Follower {
   }
 
  private:
+  void ProcessSample(
+      int16_t audio,
+      int16_t excite,
+      uint16_t* gain,
+      uint16_t* frequency);
+  
   Svf analysis_low_;
   Svf analysis_medium_;
   int32_t energy_[kNumBands][2];
@@ -46,7 +46,7 @@ void LorenzGenerator::Init() {
   vca_amount_ = 0;
 }
 
-void LorenzGenerator::Process(
+inline void LorenzGenerator::ProcessSample(
     int16_t audio,
     int16_t excite,
     uint16_t* gain,
@@ -79,4 +79,23 @@ void LorenzGenerator::Process(
   *frequency = 65535 + ((x_scaled - 65535) * vcf_amount_ >> 15);
 }
 
+void LorenzGenerator::Process(
+    int16_t audio,
+    int16_t excite,
+    uint16_t* gain,
+    uint16_t* frequency) {
+  ProcessSample(audio, excite, gain, frequency);
+}
+
+void LorenzGenerator::Process(
+    const int16_t* audio,
+    const int16_t* excite,
+    uint16_t* gain,
+    uint16_t* frequency,
+    size_t size) {
+  while (size--) {
+    ProcessSample(*audio++, *excite++, gain++, frequency++);
+  }
+}
+
 }  // namespace streams
@@ -46,6 +46,12 @@ class LorenzGenerator {
       int16_t excite,
       uint16_t* gain,
       uint16_t* frequency);
+  void Process(
+      const int16_t* audio,
+      const int16_t* excite,
+      uint16_t* gain,
+      uint16_t* frequency,
+      size_t size);
   
   void set_index(uint8_t index) {
     index_ = index;
@@ -63,6 +69,12 @@ class LorenzGenerator {
 
 
  private:
+  void ProcessSample(
+      int16_t audio,
+      int16_t excite,
+      uint16_t* gain,
+      uint16_t* frequency);
+  
   int32_t x_, y_, z_;
   int32_t rate_;
   int32_t vcf_amount_;
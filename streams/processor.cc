@@ -38,6 +38,7 @@ using namespace std;
 #define REGISTER_PROCESSOR(ClassName) \
   { &Processor::ClassName ## Init, \
     &Processor::ClassName ## Process, \
+    &Processor::ClassName ## ProcessBlock, \
     &Processor::ClassName ## Configure },
 
 /* static */
@@ -59,6 +59,14 @@ enum ProcessorFunction {
   void ClassName ## Process(int16_t a, int16_t e, uint16_t* g, uint16_t* f) { \
     variable.Process(a, e, g, f); \
   } \
+  void ClassName ## ProcessBlock( \
+      const int16_t* a, \
+      const int16_t* e, \
+      uint16_t* g, \
+      uint16_t* f, \
+      size_t n) { \
+    variable.Process(a, e, g, f, n); \
+  } \
   void ClassName ## Configure(bool a, int32_t* p, int32_t* g) { \
     variable.Configure(a, p, g); \
   } \
@@ -79,6 +87,12 @@ class Processor {
       int16_t,
       uint16_t*,
       uint16_t*); 
+  typedef void (Processor::*ProcessBlockFn)(
+      const int16_t*,
+      const int16_t*,
+      uint16_t*,
+      uint16_t*,
+      size_t);
   typedef void (Processor::*ConfigureFn)(
       bool,
       int32_t*,
@@ -87,6 +101,7 @@ class Processor {
   struct ProcessorCallbacks {
     InitFn init;
     ProcessFn process;
+    ProcessBlockFn process_block;
     ConfigureFn configure;
   };
   
@@ -133,6 +148,22 @@ class Processor {
     last_frequency_value_ = *frequency;
   }
 
+  // Block version, for offline processing: the current function is
+  // dispatched once for the whole block.
+  inline void Process(
+      const int16_t* audio,
+      const int16_t* excite,
+      uint16_t* gain,
+      uint16_t* frequency,
+      size_t size) {
+    if (!size) {
+      return;
+    }
+    (this->*callbacks_.process_block)(audio, excite, gain, frequency, size);
+    last_gain_value_ = gain[size - 1];
+    last_frequency_value_ = frequency[size - 1];
+  }
+
   void Configure() {
     if (!dirty_) {
       return;
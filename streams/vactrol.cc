@@ -46,7 +46,7 @@ void Vactrol::Init() {
   excite_ = 0;
 }
 
-void Vactrol::Process(
+inline void Vactrol::ProcessSample(
     int16_t audio,
     int16_t excite,
     uint16_t* gain,
@@ -183,4 +183,23 @@ void Vactrol::Process(
        (frequency_amount_ * cutoff >> 15);
 }
 
+void Vactrol::Process(
+    int16_t audio,
+    int16_t excite,
+    uint16_t* gain,
+    uint16_t* frequency) {
+  ProcessSample(audio, excite, gain, frequency);
+}
+
+void Vactrol::Process(
+    const int16_t* audio,
+    const int16_t* excite,
+    uint16_t* gain,
+    uint16_t* frequency,
+    size_t size) {
+  while (size--) {
+    ProcessSample(*audio++, *excite++, gain++, frequency++);
+  }
+}
+
 }  // namespace streams
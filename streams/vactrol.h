@@ -47,6 +47,12 @@ class Vactrol {
       int16_t excite,
       uint16_t* gain,
       uint16_t* frequency);
+  void Process(
+      const int16_t* audio,
+      const int16_t* excite,
+      uint16_t* gain,
+      uint16_t* frequency,
+      size_t size);
 
   void Configure(bool alternate, int32_t* parameters, int32_t* globals) {
     uint16_t attack_time;
@@ -115,6 +121,12 @@ class Vactrol {
 
 
  private:
+  void ProcessSample(
+      int16_t audio,
+      int16_t excite,
+      uint16_t* gain,
+      uint16_t* frequency);
+  
   int32_t target_frequency_amount_;
   int32_t target_frequency_offset_;
   int32_t frequency_amount_;
@@ -48,16 +48,52 @@ void JustIntonationProcessor::Init() {
   std::fill(&history_[0], &history_[kHistorySize], e);
 }
 
-int JustIntonationProcessor::Tune(int note, int min, int max, int step) {
+static inline int WrapInterval(int interval) {
+  if (interval < 0) {
+    interval += kOctave;
+  } else if (interval >= kOctave) {
+    interval -= kOctave;
+  }
+  return interval;
+}
+
+int16_t JustIntonationProcessor::Tune(int note) {
+  // The interval between a candidate and a note from the history depends on
+  // the correction only through an offset, so the modulo is computed once per
+  // note rather than once per candidate. Silent notes are skipped, and the
+  // loudest ones come first so that a losing candidate is rejected early.
+  Interval intervals[kHistorySize];
+  size_t size = 0;
+  for (size_t i = 0; i < kHistorySize; ++i) {
+    uint8_t weight = history_[i].weight;
+    if (!weight) {
+      continue;
+    }
+    size_t j = size++;
+    while (j && intervals[j - 1].weight < weight) {
+      intervals[j] = intervals[j - 1];
+      --j;
+    }
+    intervals[j].base = (note - history_[i].pitch + kOctave * 12) % kOctave;
+    intervals[j].weight = weight;
+  }
+  int coarse = Tune(intervals, size, -32, 32, 4);
+  return int16_t(note + Tune(intervals, size, coarse - 6, coarse + 6, 1));
+}
+
+int JustIntonationProcessor::Tune(
+    const Interval* intervals,
+    size_t size,
+    int min,
+    int max,
+    int step) {
   int best_score = 0x7fffffff;
   int best_correction = 0;
   for (int correction = min; correction <= max; correction += step) {
-    int score = lut_consonance[
-        correction >= 0 ? correction : (kOctave + correction)];
-    int pitch = correction + note;
-    for (size_t i = 0; i < kHistorySize; ++i) {
-      int interval = (pitch - history_[i].pitch + kOctave * 12) % kOctave;
-      score += lut_consonance[interval] * history_[i].weight;
+    int score = lut_consonance[WrapInterval(correction)];
+    for (size_t i = 0; i < size; ++i) {
+      int interval = WrapInterval(intervals[i].base + correction);
+      score += lut_consonance[interval] * intervals[i].weight;
       if (score > best_score) {
         break;
       }
@@ -96,12 +96,13 @@ class JustIntonationProcessor {
   }
   
  private:
-  int Tune(int note, int min, int max, int steps);
+  struct Interval {
+    int16_t base;  // Interval with the uncorrected note, modulo one octave.
+    uint8_t weight;
+  };
   
-  int16_t Tune(int note) {
-    int coarse = Tune(note, -32, 32, 4);
-    return int16_t(note + Tune(note, coarse - 6, coarse + 6, 1));
-  }
+  int Tune(const Interval* intervals, size_t size, int min, int max, int step);
+  int16_t Tune(int note);
 
   size_t write_ptr_;
   int16_t cached_pitch_;
@@ -31,20 +31,21 @@
 
 #include "stmlib/stmlib.h"
 
-#include "stmlib/utils/ring_buffer.h"
 #include "stmlib/midi/midi.h"
 
+#include "yarns/midi_queue.h"
 #include "yarns/multi.h"
 
 namespace yarns {
 
 const size_t kSysexMaxChunkSize = 64;
 const size_t kSysexRxBufferSize = kSysexMaxChunkSize * 2 + 16;
+const size_t kMidiInputBurstSize = 16;
 
 class MidiHandler {
  public:
-  typedef stmlib::RingBuffer<uint8_t, 128> MidiBuffer;
-  typedef stmlib::RingBuffer<uint8_t, 32> SmallMidiBuffer;
+  typedef MidiQueue<128> MidiBuffer;
+  typedef MidiQueue<32> SmallMidiBuffer;
    
   MidiHandler() { }
   ~MidiHandler() { }
@@ -145,7 +146,7 @@ class MidiHandler {
   static void RawByte(uint8_t byte) {
     if (multi.direct_thru()) {
       if (byte != 0xfa && byte != 0xf8 && byte != 0xfc) {
-        output_buffer_.Overwrite(byte);
+        output_buffer_.Write(byte);
       }
     }
   }
@@ -182,13 +183,31 @@ class MidiHandler {
   }
   
   static void PushByte(uint8_t byte) {
-    input_buffer_.Overwrite(byte);
+    input_buffer_.Write(byte);
   }
   
   static void ProcessInput() {
-    while (input_buffer_.readable()) {
-      parser_.PushByte(input_buffer_.ImmediateRead());
+    uint8_t bytes[kMidiInputBurstSize];
+    size_t size;
+    while ((size = input_buffer_.Read(bytes, kMidiInputBurstSize)) != 0) {
+      for (size_t i = 0; i < size; ++i) {
+        parser_.PushByte(bytes[i]);
+      }
+    }
+  }
+  
+  // Returns the next byte to transmit. Realtime messages (clock, start, stop)
+  // take precedence over everything else - MIDI allows them to be interleaved
+  // within other messages, so they never wait behind a backlog of notes.
+  static inline bool PopOutputByte(uint8_t* byte) {
+    if (high_priority_output_buffer_.readable()) {
+      *byte = high_priority_output_buffer_.ImmediateRead();
+      return true;
+    } else if (output_buffer_.readable()) {
+      *byte = output_buffer_.ImmediateRead();
+      return true;
     }
+    return false;
   }
   
   static inline MidiBuffer* mutable_output_buffer() { return &output_buffer_; }
@@ -196,27 +215,40 @@ class MidiHandler {
     return &high_priority_output_buffer_;
   }
 
+  // Messages are queued whole or not at all: when the output is saturated,
+  // the most recent messages are dropped (and counted) rather than corrupting
+  // the ones already queued.
   static inline void Send3(uint8_t byte_1, uint8_t byte_2, uint8_t byte_3) {
-    output_buffer_.Overwrite(byte_1);
-    output_buffer_.Overwrite(byte_2);
-    output_buffer_.Overwrite(byte_3);
+    uint8_t message[3] = { byte_1, byte_2, byte_3 };
+    output_buffer_.Write(message, 3);
   }
 
   static inline void Send2(uint8_t byte_1, uint8_t byte_2) {
-    output_buffer_.Overwrite(byte_1);
-    output_buffer_.Overwrite(byte_2);
+    uint8_t message[2] = { byte_1, byte_2 };
+    output_buffer_.Write(message, 2);
   }
 
   static inline void Send1(uint8_t byte) {
-    output_buffer_.Overwrite(byte);
+    output_buffer_.Write(byte);
   }
   
+  // Waits for the output ISR to make room. Only to be called from the main
+  // loop, for bulk transfers (SysEx dumps) which must not lose any byte.
   static inline void SendBlocking(uint8_t byte) {
+    while (!output_buffer_.writable());
     output_buffer_.Write(byte);
   }
 
   static inline void SendNow(uint8_t byte) {
-    high_priority_output_buffer_.Overwrite(byte);
+    high_priority_output_buffer_.Write(byte);
+  }
+  
+  static inline uint32_t input_overflows() {
+    return input_buffer_.overflows();
+  }
+  static inline uint32_t output_overflows() {
+    return output_buffer_.overflows() +
+        high_priority_output_buffer_.overflows();
   }
   
   typedef void (*SysExHandlerFn)();
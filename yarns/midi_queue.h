@@ -0,0 +1,137 @@
+// Copyright 2013 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Single producer / single consumer byte queue for MIDI I/O.
+//
+// The read and write counters are free running and each of them is only ever
+// modified by one side (the ISR or the main loop), so no locking is needed on
+// a single core. Unlike stmlib::RingBuffer, a full queue never overwrites
+// unread data: the incoming bytes are dropped and counted instead, and a
+// complete message can be queued all-or-nothing so that the receiver never
+// sees a torn message.
+
+#ifndef YARNS_MIDI_QUEUE_H_
+#define YARNS_MIDI_QUEUE_H_
+
+#include "stmlib/stmlib.h"
+
+namespace yarns {
+
+template<size_t size>
+class MidiQueue {
+ public:
+  MidiQueue() { }
+  ~MidiQueue() { }
+
+  void Init() {
+    read_ptr_ = write_ptr_ = 0;
+    overflows_ = 0;
+  }
+
+  inline size_t capacity() const { return size; }
+  inline size_t readable() const {
+    return static_cast<uint16_t>(write_ptr_ - read_ptr_);
+  }
+  inline size_t writable() const { return size - readable(); }
+
+  // Producer side.
+  inline bool Write(uint8_t byte) {
+    uint16_t w = write_ptr_;
+    if (static_cast<uint16_t>(w - read_ptr_) >= size) {
+      ++overflows_;
+      return false;
+    }
+    buffer_[w & kMask] = byte;
+    Barrier();
+    write_ptr_ = w + 1;
+    return true;
+  }
+
+  // Queues the whole message, or nothing at all if there is not enough room.
+  inline bool Write(const uint8_t* data, size_t data_size) {
+    uint16_t w = write_ptr_;
+    if (static_cast<uint16_t>(w - read_ptr_) + data_size > size) {
+      ++overflows_;
+      return false;
+    }
+    for (size_t i = 0; i < data_size; ++i) {
+      buffer_[(w + i) & kMask] = data[i];
+    }
+    Barrier();
+    write_ptr_ = w + data_size;
+    return true;
+  }
+
+  // Consumer side.
+  inline uint8_t ImmediateRead() {
+    uint16_t r = read_ptr_;
+    uint8_t result = buffer_[r & kMask];
+    Barrier();
+    read_ptr_ = r + 1;
+    return result;
+  }
+
+  // Drains up to max_size bytes at once, and returns the number of bytes read.
+  inline size_t Read(uint8_t* destination, size_t max_size) {
+    uint16_t r = read_ptr_;
+    size_t n = static_cast<uint16_t>(write_ptr_ - r);
+    if (n > max_size) {
+      n = max_size;
+    }
+    for (size_t i = 0; i < n; ++i) {
+      destination[i] = buffer_[(r + i) & kMask];
+    }
+    Barrier();
+    read_ptr_ = r + n;
+    return n;
+  }
+
+  inline void Flush() { read_ptr_ = write_ptr_; }
+
+  // Number of writes (bytes or whole messages) rejected since Init().
+  inline uint32_t overflows() const { return overflows_; }
+
+ private:
+  static const uint16_t kMask = size - 1;
+
+  // Prevents the compiler from moving the buffer accesses past the update of
+  // the pointer which publishes them to the other side.
+  static inline void Barrier() { __asm__ __volatile__("" ::: "memory"); }
+
+  typedef char SizeMustBeAPowerOfTwo[
+      (size & (size - 1)) == 0 && size <= 32768 ? 1 : -1];
+
+  uint8_t buffer_[size];
+  volatile uint16_t read_ptr_;
+  volatile uint16_t write_ptr_;
+  uint32_t overflows_;
+
+  DISALLOW_COPY_AND_ASSIGN(MidiQueue);
+};
+
+}  // namespace yarns
+
+#endif  // YARNS_MIDI_QUEUE_H_
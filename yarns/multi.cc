@@ -45,6 +45,10 @@ const uint8_t clock_divisions[] = {
   96, 48, 32, 24, 16, 12, 8, 6, 4, 3, 2, 1
 };
 
+const uint8_t song_bank[] = {
+  #include "song/song.h"
+};
+
 void Multi::Init() {
   just_intonation_processor.Init();
   
@@ -60,6 +64,9 @@ void Multi::Init() {
   for (uint8_t i = 0; i < kNumVoices; ++i) {
     voice_[i].Init();
   }
+  internal_clock_ticks_ = processed_internal_clock_ticks_ = 0;
+  song_bank_.Init(song_bank);
+  song_reader_.Init();
   running_ = false;
   latched_ = false;
   recording_ = false;
@@ -158,7 +165,7 @@ void Multi::Clock() {
   if (!clock_input_prescaler_) {
     midi_handler.OnClock();
     
-    if (song_pointer_) {
+    if (song_reader_.playing()) {
       ClockSong();
     } else {
       for (uint8_t i = 0; i < num_active_parts_; ++i) {
@@ -201,7 +208,7 @@ void Multi::Start(bool started_by_keyboard) {
     return;
   }
   if (internal_clock()) {
-    internal_clock_ticks_ = 0;
+    processed_internal_clock_ticks_ = internal_clock_ticks_;
     internal_clock_.Start(settings_.clock_tempo, settings_.clock_swing);
   }
   midi_handler.OnStart();
@@ -216,7 +223,7 @@ void Multi::Start(bool started_by_keyboard) {
   for (uint8_t i = 0; i < num_active_parts_; ++i) {
     part_[i].Start(started_by_keyboard);
   }
-  song_pointer_ = NULL;
+  song_reader_.Stop();
 }
 
 void Multi::Stop() {
@@ -233,7 +240,7 @@ void Multi::Stop() {
   running_ = false;
   latched_ = false;
   started_by_keyboard_ = false;
-  song_pointer_ = NULL;
+  song_reader_.Stop();
 }
 
 void Multi::Refresh() {
@@ -702,49 +709,47 @@ void Multi::Touch() {
   }
 }
 
-
-const uint8_t song[] = {
-  #include "song/song.h"
-  255,
-};
-
-void Multi::StartSong() {
-  Set(MULTI_LAYOUT, LAYOUT_QUAD_MONO);
-  part_[0].mutable_voicing_settings()->audio_mode = 0x83;
-  part_[1].mutable_voicing_settings()->audio_mode = 0x83;
-  part_[2].mutable_voicing_settings()->audio_mode = 0x84;
-  part_[3].mutable_voicing_settings()->audio_mode = 0x86;
+void Multi::StartSong(uint8_t index) {
+  if (index >= song_bank_.num_entries()) {
+    return;
+  }
+  for (uint8_t i = 0; i < song_bank_.num_settings(index); ++i) {
+    const uint8_t* setting = song_bank_.setting(index, i);
+    if (setting[0] == kSongTargetMulti) {
+      Set(setting[1], setting[2]);
+    } else if (setting[0] < kNumParts) {
+      part_[setting[0]].Set(setting[1], setting[2]);
+    }
+  }
   UpdateLayout();
-  settings_.clock_tempo = 140;
+  
+  const uint8_t* events = song_bank_.events(index);
+  if (*events == SONG_OPCODE_END) {
+    return;
+  }
   Stop();
   Start(false);
-  
-  song_pointer_ = &song[0];
-  song_clock_ = 0;
-  song_delta_ = 0;
+  song_reader_.Start(events, song_bank_.base_note(index));
 }
 
 void Multi::ClockSong() {
-  while (song_clock_ >= song_delta_) {
-    if (*song_pointer_ == 255) {
-      song_pointer_ = &song[0];
-    }
-    if (*song_pointer_ == 254) {
-      song_delta_ += 6;
-    } else {
-      uint8_t part = *song_pointer_ >> 6;
-      uint8_t note = *song_pointer_ & 0x3f;
-      if (note == 0) {
-        part_[part].AllNotesOff();
-      } else {
-        part_[part].NoteOn(0, note + 24, 100);
-      }
-      song_clock_ = 0;
-      song_delta_ = 0;
+  SongEvent e;
+  while (song_reader_.Read(&e)) {
+    switch (e.type) {
+      case SONG_EVENT_NOTE_ON:
+        part_[e.part].NoteOn(0, e.note, e.velocity);
+        break;
+      
+      case SONG_EVENT_NOTE_OFF:
+        part_[e.part].NoteOff(0, e.note);
+        break;
+      
+      case SONG_EVENT_ALL_NOTES_OFF:
+        part_[e.part].AllNotesOff();
+        break;
     }
-    ++song_pointer_;
   }
-  ++song_clock_;
+  song_reader_.Tick();
 }
 
 bool Multi::ControlChange(uint8_t channel, uint8_t controller, uint8_t value) {
@@ -34,6 +34,7 @@
 #include "yarns/internal_clock.h"
 #include "yarns/layout_configurator.h"
 #include "yarns/part.h"
+#include "yarns/song_bank.h"
 #include "yarns/voice.h"
 
 namespace yarns {
@@ -274,9 +275,9 @@ class Multi {
     }
   }
   void ProcessInternalClockEvents() {
-    while (internal_clock_ticks_) {
+    while (processed_internal_clock_ticks_ != internal_clock_ticks_) {
       Clock();
-      --internal_clock_ticks_;
+      ++processed_internal_clock_ticks_;
     }
   }
 
@@ -392,7 +393,9 @@ class Multi {
     return layout_configurator_.learning();
   }
   
-  void StartSong();
+  // Loads the settings of an entry from the song bank, and starts playing
+  // its events, if any.
+  void StartSong(uint8_t index);
 
  private:
   void ChangeLayout(Layout old_layout, Layout new_layout);
@@ -408,7 +411,11 @@ class Multi {
   bool recording_;
   
   InternalClock internal_clock_;
-  uint8_t internal_clock_ticks_;
+  // Ticks counted by the interrupt, and ticks processed by the main loop.
+  // Each counter has a single writer, so no tick is lost - as long as the
+  // main loop is not stalled for more than 65535 ticks.
+  volatile uint16_t internal_clock_ticks_;
+  uint16_t processed_internal_clock_ticks_;
   
   uint8_t clock_input_prescaler_;
   uint8_t clock_output_prescaler_;
@@ -429,9 +436,8 @@ class Multi {
 
   LayoutConfigurator layout_configurator_;
   
-  const uint8_t* song_pointer_;
-  uint32_t song_clock_;
-  uint8_t song_delta_;
+  SongBank song_bank_;
+  SongReader song_reader_;
 
   DISALLOW_COPY_AND_ASSIGN(Multi);
 };
@@ -63,6 +63,11 @@ void Part::Init() {
   seq_recording_ = false;
   seq_running_ = false;
   release_latched_keys_on_next_note_on_ = false;
+  arp_position_ = 0;
+  arp_num_positions_ = 0;
+  arp_loop_position_ = 0;
+  arp_compiled_num_notes_ = 0;
+  compiled_playback_ = COMPILED_PLAYBACK_NONE;
 }
   
 void Part::AllocateVoices(Voice* voice, uint8_t num_voices, bool polychain) {
@@ -93,6 +98,7 @@ bool Part::NoteOn(uint8_t channel, uint8_t note, uint8_t velocity) {
     ignore_note_off_messages_ = still_latched;
   }
   pressed_keys_.NoteOn(note, velocity);
+  TouchPlayback();
   
   if ((!(seq_.num_steps && seq_running_) && !seq_.arp_range)
       || sent_from_step_editor) {
@@ -118,6 +124,7 @@ bool Part::NoteOff(uint8_t channel, uint8_t note) {
     }
   } else {
     pressed_keys_.NoteOff(note);
+    TouchPlayback();
     
     if ((!(seq_.num_steps && seq_running_) && !seq_.arp_range) ||
         sent_from_step_editor) {
@@ -201,6 +208,7 @@ bool Part::PitchBend(uint8_t channel, uint16_t pitch_bend) {
   if (seq_recording_ &&
       (pitch_bend > 8192 + 2048 || pitch_bend < 8192 - 2048)) {
     seq_.step[seq_rec_step_].data[1] |= 0x80;
+    TouchPlayback();
   }
   
   return midi_.out_mode != MIDI_OUT_MODE_OFF;
@@ -238,9 +246,9 @@ void Part::Reset() {
 
 void Part::Clock() {
   if (!arp_seq_prescaler_) {
-    if (seq_.num_steps && seq_running_) {
+    if (compiled_playback_ == COMPILED_PLAYBACK_SEQUENCER) {
       ClockSequencer();
-    } else if (seq_.arp_range) {
+    } else if (compiled_playback_ == COMPILED_PLAYBACK_ARPEGGIATOR) {
       ClockArpeggiator();
     }
   }
@@ -285,6 +293,8 @@ void Part::Start(bool started_by_keyboard) {
     arp_direction_ = 1;
   }
   arp_step_ = 0;
+  arp_position_ = 0;
+  TouchPlayback();
   
   lfo_counter_ = 0;
   
@@ -293,6 +303,7 @@ void Part::Start(bool started_by_keyboard) {
 
 void Part::Stop() {
   seq_running_ = false;
+  TouchPlayback();
   StopSequencerArpeggiatorNotes();
   AllNotesOff();
 }
@@ -311,6 +322,7 @@ void Part::StartRecording() {
         SequencerStep(SEQUENCER_STEP_REST, 0));
     seq_.num_steps = 0;
   }
+  TouchPlayback();
 }
 
 void Part::StopSequencerArpeggiatorNotes() {
@@ -321,25 +333,50 @@ void Part::StopSequencerArpeggiatorNotes() {
   }
 }
 
-void Part::ClockSequencer() {
-  const SequencerStep& step = seq_.step[seq_step_];
+void Part::TouchPlayback() {
+  if (seq_.num_steps && seq_running_) {
+    CompileSequencer();
+  } else if (seq_.arp_range) {
+    CompileArpeggiator();
+  } else {
+    compiled_playback_ = COMPILED_PLAYBACK_NONE;
+  }
+}
 
-  if (step.has_note()) {
-    int16_t note = step.note();
-    if (pressed_keys_.size() && !seq_recording_) {
-      // When we play a monophonic sequence, we can make the guess that root
-      // note = first note.
-      // But this is not the case when we are playing several sequences at the
-      // same time. In this case, we use root note = 60.
-      int8_t root_note = !has_siblings_ ? seq_.first_note() : 60;
-      note += pressed_keys_.most_recent_note().note - root_note;
+void Part::CompileSequencer() {
+  SyncArpeggiator();
+  
+  bool transpose = pressed_keys_.size() && !seq_recording_;
+  int16_t transposition = 0;
+  if (transpose) {
+    // When we play a monophonic sequence, we can make the guess that root
+    // note = first note.
+    // But this is not the case when we are playing several sequences at the
+    // same time. In this case, we use root note = 60.
+    int8_t root_note = !has_siblings_ ? seq_.first_note() : 60;
+    transposition = pressed_keys_.most_recent_note().note - root_note;
+  }
+  for (uint8_t i = 0; i < kNumSteps; ++i) {
+    SequencerStep step = seq_.step[i];
+    if (step.has_note() && transpose) {
+      int16_t note = step.note() + transposition;
       while (note > 127) {
         note -= 12;
       }
       while (note < 0) {
         note += 12;
       }
+      step.data[0] = note;
     }
+    compiled_step_[i] = step;
+  }
+  compiled_playback_ = COMPILED_PLAYBACK_SEQUENCER;
+}
+
+void Part::ClockSequencer() {
+  const SequencerStep& step = compiled_step_[seq_step_];
+  if (step.has_note()) {
+    uint8_t note = step.note();
     if (!step.is_slid()) {
       StopSequencerArpeggiatorNotes();
       InternalNoteOn(note, step.velocity());
@@ -354,91 +391,205 @@ void Part::ClockSequencer() {
   if (seq_step_ >= seq_.num_steps) {
     seq_step_ = 0;
   }
-  if (seq_.step[seq_step_].is_tie() || seq_.step[seq_step_].is_slid()) {
+  const SequencerStep& next_step = compiled_step_[seq_step_];
+  if (next_step.is_tie() || next_step.is_slid()) {
     // The next step contains a "sustain" message; or a slid note. Extends
     // the duration of the current note.
     gate_length_counter_ += clock_divisions[seq_.clock_division];
   }
 }
 
-void Part::ClockArpeggiator() {
-  uint32_t pattern_mask = 1 << arp_step_;
+void Part::AdvanceArpeggiator(
+    uint8_t num_notes,
+    uint8_t range,
+    uint8_t direction) {
+  if (num_notes == 1 && range == 1) {
+    // This is a corner case for the Up/down pattern code.
+    // Get it out of the way.
+    arp_note_ = 0;
+    arp_octave_ = 0;
+  } else if (direction == ARPEGGIATOR_DIRECTION_RANDOM) {
+    uint16_t random = Random::GetSample();
+    arp_octave_ = (random & 0xff) % range;
+    arp_note_ = (random >> 8) % num_notes;
+  } else {
+    bool wrapped = true;
+    while (wrapped) {
+      if (arp_note_ >= num_notes || arp_note_ < 0) {
+        arp_octave_ += arp_direction_;
+        arp_note_ = arp_direction_ > 0 ? 0 : num_notes - 1;
+      }
+      wrapped = false;
+      if (arp_octave_ >= range || arp_octave_ < 0) {
+        arp_octave_ = arp_direction_ > 0 ? 0 : range - 1;
+        if (direction == ARPEGGIATOR_DIRECTION_UP_DOWN) {
+          arp_direction_ = -arp_direction_;
+          arp_note_ = arp_direction_ > 0 ? 1 : num_notes - 2;
+          arp_octave_ = arp_direction_ > 0 ? 0 : range - 1;
+          wrapped = true;
+        }
+      }
+    }
+  }
+}
 
-  uint32_t pattern = lut_arpeggiator_patterns[seq_.arp_pattern];
-  uint32_t pattern_length = 16;
+void Part::SyncArpeggiator() {
+  // Replays the steps played since the last compilation, with the settings
+  // and number of notes in use at that time.
+  for (uint8_t i = 0; i < arp_position_; ++i) {
+    AdvanceArpeggiator(
+        arp_compiled_num_notes_,
+        arp_compiled_range_,
+        arp_compiled_direction_);
+    arp_note_ += arp_direction_;
+  }
+  arp_position_ = 0;
+}
+
+void Part::CompileArpeggiator() {
+  SyncArpeggiator();
+  
+  uint8_t num_notes = pressed_keys_.size();
+  uint8_t range = seq_.arp_range;
+  uint8_t direction = seq_.arp_direction;
+  arp_compiled_num_notes_ = num_notes;
+  arp_compiled_range_ = range;
+  arp_compiled_direction_ = direction;
   
+  // Unroll the rhythmic pattern, rotation included, over all the values
+  // arp_step_ can take.
+  uint32_t pattern = lut_arpeggiator_patterns[seq_.arp_pattern];
+  arp_rhythm_length_ = 16;
+  arp_rhythm_ = pattern;
   if (seq_.euclidean_length != 0) {
-    pattern_length = seq_.euclidean_length;
-    pattern_mask = 1 << ((arp_step_ + seq_.euclidean_rotate) % pattern_length);
+    arp_rhythm_length_ = seq_.euclidean_length;
     // Read euclidean pattern from ROM.
     uint16_t offset = static_cast<uint16_t>(seq_.euclidean_length - 1) * 32;
     pattern = lut_euclidean[offset + seq_.euclidean_fill];
+    arp_rhythm_ = 0;
+    for (uint8_t i = 0; i < 32; ++i) {
+      uint8_t bit = (i + seq_.euclidean_rotate) % arp_rhythm_length_;
+      if (pattern & (1UL << bit)) {
+        arp_rhythm_ |= 1UL << i;
+      }
+    }
   }
   
-  uint8_t num_notes = pressed_keys_.size();
-  if ((pattern_mask & pattern) && num_notes) {
-    // Update arepggiator note/octave counter.
-    if (num_notes == 1 && seq_.arp_range == 1) {
-      // This is a corner case for the Up/down pattern code.
-      // Get it out of the way.
-      arp_note_ = 0;
-      arp_octave_ = 0;
-    } else {
-      if (seq_.arp_direction == ARPEGGIATOR_DIRECTION_RANDOM) {
-        uint16_t random = Random::GetSample();
-        arp_octave_ = (random & 0xff) % seq_.arp_range;
-        arp_note_ = (random >> 8) % num_notes;
-      } else {
-        bool wrapped = true;
-        while (wrapped) {
-          if (arp_note_ >= num_notes || arp_note_ < 0) {
-            arp_octave_ += arp_direction_;
-            arp_note_ = arp_direction_ > 0 ? 0 : num_notes - 1;
-          }
-          wrapped = false;
-          if (arp_octave_ >= seq_.arp_range || arp_octave_ < 0) {
-            arp_octave_ = arp_direction_ > 0 ? 0 : seq_.arp_range - 1;
-            if (seq_.arp_direction == ARPEGGIATOR_DIRECTION_UP_DOWN) {
-              arp_direction_ = -arp_direction_;
-              arp_note_ = arp_direction_ > 0 ? 1 : num_notes - 2;
-              arp_octave_ = arp_direction_ > 0 ? 0 : seq_.arp_range - 1;
-              wrapped = true;
-            }
-          }
-        }
+  arp_num_positions_ = 0;
+  arp_loop_position_ = 0;
+  if (!num_notes) {
+    compiled_playback_ = COMPILED_PLAYBACK_ARPEGGIATOR;
+    return;
+  }
+  
+  if (direction == ARPEGGIATOR_DIRECTION_RANDOM) {
+    // The walk is not deterministic. Only the notes are compiled.
+    for (uint8_t i = 0; i < num_notes; ++i) {
+      const NoteEntry& e = pressed_keys_.sorted_note(i);
+      compiled_step_[i] = SequencerStep(e.note, e.velocity & 0x7f);
+    }
+    compiled_playback_ = COMPILED_PLAYBACK_ARPEGGIATOR;
+    return;
+  }
+  
+  // Walk through the arpeggiator states until one of them repeats. Past the
+  // first position, the state reached by a position follows from the
+  // in-range (note, octave, direction) played by the previous one, so the
+  // table is indexed by the latter and records the position it leads to.
+  int8_t note = arp_note_;
+  int8_t octave = arp_octave_;
+  int8_t note_direction = arp_direction_;
+  uint8_t next_position[kNumArpeggiatorStates];
+  fill(&next_position[0], &next_position[kNumArpeggiatorStates], 0xff);
+  while (true) {
+    AdvanceArpeggiator(num_notes, range, direction);
+    if (direction != ARPEGGIATOR_DIRECTION_CHORD) {
+      const NoteEntry& e = direction == ARPEGGIATOR_DIRECTION_AS_PLAYED ?
+          pressed_keys_.played_note(arp_note_) :
+          pressed_keys_.sorted_note(arp_note_);
+      uint8_t arpeggio_note = e.note + 12 * arp_octave_;
+      while (arpeggio_note > 127) {
+        arpeggio_note -= 12;
+      }
+      compiled_step_[arp_num_positions_] = SequencerStep(
+          arpeggio_note, e.velocity & 0x7f);
+    }
+    ++arp_num_positions_;
+    if (arp_octave_ < kMaxArpeggiatorRange) {
+      uint8_t state = ((arp_note_ * kMaxArpeggiatorRange + arp_octave_) << 1) |
+          (arp_direction_ > 0);
+      if (next_position[state] != 0xff) {
+        arp_loop_position_ = next_position[state];
+        break;
       }
+      next_position[state] = arp_num_positions_;
+    }
+    arp_note_ += arp_direction_;
+    if ((arp_note_ == note && arp_octave_ == octave &&
+         arp_direction_ == note_direction) ||
+        arp_num_positions_ == kMaxCompiledSteps) {
+      arp_loop_position_ = 0;
+      break;
+    }
+  }
+  arp_note_ = note;
+  arp_octave_ = octave;
+  arp_direction_ = note_direction;
+  
+  if (direction == ARPEGGIATOR_DIRECTION_CHORD) {
+    for (uint8_t i = 0; i < num_notes; ++i) {
+      const NoteEntry& e = pressed_keys_.played_note(i);
+      compiled_step_[i] = SequencerStep(e.note, e.velocity & 0x7f);
+    }
+  }
+  compiled_playback_ = COMPILED_PLAYBACK_ARPEGGIATOR;
+}
+
+void Part::ClockArpeggiator() {
+  uint8_t num_notes = arp_compiled_num_notes_;
+  if (((arp_rhythm_ >> arp_step_) & 1) && num_notes) {
+    if (arp_compiled_direction_ == ARPEGGIATOR_DIRECTION_RANDOM) {
+      AdvanceArpeggiator(
+          num_notes,
+          arp_compiled_range_,
+          arp_compiled_direction_);
     }
     
     // Kill pending notes (if any).
     StopSequencerArpeggiatorNotes();
     
     // Trigger arpeggiated note or chord.
-    if (seq_.arp_direction != ARPEGGIATOR_DIRECTION_CHORD) {
-      const NoteEntry* arpeggio_note = \
-          seq_.arp_direction == ARPEGGIATOR_DIRECTION_AS_PLAYED ?
-          &pressed_keys_.played_note(arp_note_) :
-          &pressed_keys_.sorted_note(arp_note_);
-      uint8_t note = arpeggio_note->note;
-      uint8_t velocity = arpeggio_note->velocity & 0x7f;
-      note += 12 * arp_octave_;
+    if (arp_compiled_direction_ == ARPEGGIATOR_DIRECTION_RANDOM) {
+      const SequencerStep& step = compiled_step_[arp_note_];
+      uint8_t note = step.note() + 12 * arp_octave_;
       while (note > 127) {
         note -= 12;
       }
-      generated_notes_.NoteOn(note, velocity);
-      InternalNoteOn(note, velocity);
+      generated_notes_.NoteOn(note, step.velocity());
+      InternalNoteOn(note, step.velocity());
+      arp_note_ += arp_direction_;
     } else {
-      for (uint8_t i = 0; i < num_notes; ++i) {
-        const NoteEntry& chord_note = pressed_keys_.played_note(i);
-        generated_notes_.NoteOn(chord_note.note, chord_note.velocity & 0x7f);
-        InternalNoteOn(chord_note.note, chord_note.velocity & 0x7f);
+      if (arp_compiled_direction_ == ARPEGGIATOR_DIRECTION_CHORD) {
+        for (uint8_t i = 0; i < num_notes; ++i) {
+          const SequencerStep& step = compiled_step_[i];
+          generated_notes_.NoteOn(step.note(), step.velocity());
+          InternalNoteOn(step.note(), step.velocity());
+        }
+      } else {
+        const SequencerStep& step = compiled_step_[arp_position_];
+        generated_notes_.NoteOn(step.note(), step.velocity());
+        InternalNoteOn(step.note(), step.velocity());
+      }
+      ++arp_position_;
+      if (arp_position_ >= arp_num_positions_) {
+        arp_position_ = arp_loop_position_;
       }
     }
-    arp_note_ += arp_direction_;
     gate_length_counter_ = seq_.gate_length;
   }
   
   ++arp_step_;
-  if (arp_step_ >= pattern_length) {
+  if (arp_step_ >= arp_rhythm_length_) {
     arp_step_ = 0;
   }
 }
@@ -454,6 +605,7 @@ void Part::AllNotesOff() {
   poly_allocator_.ClearNotes();
   mono_allocator_.Clear();
   pressed_keys_.Clear();
+  TouchPlayback();
   for (uint8_t i = 0; i < num_voices_; ++i) {
     voice_[i]->NoteOff();
   }
@@ -688,10 +840,14 @@ void Part::Set(uint8_t address, uint8_t value) {
         break;
         
       case PART_SEQUENCER_ARP_DIRECTION:
+        SyncArpeggiator();
         arp_direction_ = \
             seq_.arp_direction == ARPEGGIATOR_DIRECTION_DOWN ? -1 : 1;
         break;
     }
+    if (address > PART_VOICING_LAST) {
+      TouchPlayback();
+    }
   }
 }
 
@@ -42,6 +42,15 @@ class Voice;
 const uint8_t kNumSteps = 64;
 const uint8_t kMaxNumVoices = 4;
 
+// Large enough for a sequence, or for the longest walk through the
+// arpeggiator states (up/down, 12 notes, 4 octaves).
+const uint8_t kMaxCompiledSteps = 96;
+
+// The states of the arpeggiator walk (note, octave, direction) are indexed
+// directly, for up to 12 held notes and an arpeggiator range of 4 octaves.
+const uint8_t kMaxArpeggiatorRange = 4;
+const uint8_t kNumArpeggiatorStates = 12 * kMaxArpeggiatorRange * 2;
+
 enum ArpeggiatorDirection {
   ARPEGGIATOR_DIRECTION_UP,
   ARPEGGIATOR_DIRECTION_DOWN,
@@ -52,6 +61,12 @@ enum ArpeggiatorDirection {
   ARPEGGIATOR_DIRECTION_LAST
 };
 
+enum CompiledPlayback {
+  COMPILED_PLAYBACK_NONE,
+  COMPILED_PLAYBACK_SEQUENCER,
+  COMPILED_PLAYBACK_ARPEGGIATOR
+};
+
 enum VoiceAllocationMode {
   VOICE_ALLOCATION_MODE_MONO,
   VOICE_ALLOCATION_MODE_POLY,
@@ -235,6 +250,7 @@ class Part {
   void Stop();
   void StopRecording() {
     seq_recording_ = false;
+    TouchPlayback();
   }
   void StartRecording();
   
@@ -252,12 +268,14 @@ class Part {
       if (seq_rec_step_ >= last_step) {
         seq_rec_step_ = 0;
       }
+      TouchPlayback();
     }
   }
 
   inline void ModifyNoteAtCurrentStep(uint8_t note) {
     if (seq_recording_) {
       seq_.step[seq_rec_step_].data[0] = note;
+      TouchPlayback();
     }
   }
   
@@ -332,6 +350,7 @@ class Part {
   void Touch() {
     TouchVoices();
     TouchVoiceAllocation();
+    TouchPlayback();
   }
   
   inline void Latch() {
@@ -345,6 +364,7 @@ class Part {
   
   void set_siblings(bool has_siblings) {
     has_siblings_ = has_siblings;
+    TouchPlayback();
   }
   
  private:
@@ -362,6 +382,18 @@ class Part {
   void ClockSequencer();
   void ClockArpeggiator();
   void StopSequencerArpeggiatorNotes();
+  
+  // The notes played by the sequencer and arpeggiator are compiled into
+  // compiled_step_ whenever the settings or the held notes change - never
+  // from a clock tick, which only has to read the next entry.
+  void TouchPlayback();
+  void CompileSequencer();
+  void CompileArpeggiator();
+  void AdvanceArpeggiator(
+      uint8_t num_notes,
+      uint8_t range,
+      uint8_t direction);
+  void SyncArpeggiator();
 
   MidiSettings midi_;
   VoicingSettings voicing_;
@@ -389,6 +421,22 @@ class Part {
   int8_t arp_octave_;
   int8_t arp_direction_;
   
+  SequencerStep compiled_step_[kMaxCompiledSteps];
+  uint8_t compiled_playback_;
+  
+  // Position in the compiled walk through the arpeggiator states, and
+  // parameters of the walk (needed to bring arp_note_, arp_octave_ and
+  // arp_direction_ up to date when it is recompiled).
+  uint8_t arp_position_;
+  uint8_t arp_loop_position_;
+  uint8_t arp_num_positions_;
+  uint8_t arp_compiled_num_notes_;
+  uint8_t arp_compiled_range_;
+  uint8_t arp_compiled_direction_;
+  
+  uint32_t arp_rhythm_;
+  uint8_t arp_rhythm_length_;
+  
   bool seq_running_;
   bool seq_recording_;
   bool seq_overdubbing_;
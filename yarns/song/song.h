@@ -1,2336 +1,129 @@
-  52,
-  111,
-  144,
-  254, 
-  254, 
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  47,
-  64,
-  108,
-  128,
-  144,
-  192,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  50,
-  64,
-  111,
-  128,
-  144,
-  192,
-  254, 
-  254, 
-  0,
-  52,
-  128,
-  156,
-  210,
-  254, 
-  0,
-  50,
-  192,
-  210,
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  144,
-  192,
-  254, 
-  254, 
-  0,
-  47,
-  64,
-  108,
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  0,
-  52,
-  64,
-  112,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  0,
-  50,
-  64,
-  111,
-  128,
-  149,
-  192,
-  210,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  161,
-  192,
-  210,
-  254, 
-  254, 
-  0,
-  47,
-  64,
-  108,
-  128,
-  148,
-  192,
-  254, 
-  254, 
-  64,
-  104,
-  128,
-  160,
-  210,
-  254, 
-  254, 
-  64,
-  108,
-  128,
-  148,
-  192,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  160,
-  210,
-  254, 
-  254, 
-  0,
-  50,
-  64,
-  111,
-  128,
-  144,
-  192,
-  254, 
-  254, 
-  128,
-  156,
-  210,
-  254, 
-  192,
-  210,
-  254, 
-  0,
-  52,
-  64,
-  112,
-  128,
-  144,
-  192,
-  254, 
-  254, 
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  128,
-  151,
-  192,
-  210,
-  254, 
-  254, 
-  128,
-  152,
-  192,
-  210,
-  254, 
-  254, 
-  0,
-  64,
-  128,
-  154,
-  192,
-  254, 
-  254, 
-  50,
-  105,
-  128,
-  142,
-  210,
-  254, 
-  254, 
-  128,
-  192,
-  254, 
-  254, 
-  0,
-  53,
-  64,
-  109,
-  142,
-  210,
-  254, 
-  254, 
-  0,
-  57,
-  64,
-  112,
-  128,
-  192,
-  254, 
-  254, 
-  64,
-  112,
-  142,
-  210,
-  254, 
-  64,
-  112,
-  192,
-  210,
-  254, 
-  0,
-  55,
-  64,
-  111,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  0,
-  53,
-  64,
-  109,
-  128,
-  145,
-  210,
-  254, 
-  254, 
-  0,
-  52,
-  64,
-  107,
-  128,
-  140,
-  192,
-  254, 
-  254, 
-  128,
-  152,
-  210,
-  254, 
-  254, 
-  128,
-  192,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  104,
-  152,
-  210,
-  254, 
-  254, 
-  0,
-  52,
-  64,
-  107,
-  128,
-  140,
-  192,
-  254, 
-  254, 
-  64,
-  109,
-  128,
-  147,
-  210,
-  254, 
-  64,
-  107,
-  254, 
-  0,
-  50,
-  64,
-  105,
-  128,
-  147,
-  192,
-  210,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  104,
-  128,
-  192,
-  210,
-  254, 
-  254, 
-  0,
-  47,
-  64,
-  108,
-  151,
-  192,
-  254, 
-  254, 
-  64,
-  104,
-  128,
-  163,
-  210,
-  254, 
-  254, 
-  0,
-  47,
-  64,
-  108,
-  128,
-  192,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  163,
-  210,
-  254, 
-  254, 
-  0,
-  50,
-  64,
-  111,
-  128,
-  192,
-  254, 
-  254, 
-  64,
-  108,
-  156,
-  210,
-  254, 
-  192,
-  210,
-  254, 
-  0,
-  52,
-  64,
-  112,
-  128,
-  192,
-  254, 
-  254, 
-  64,
-  108,
-  160,
-  210,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  64,
-  104,
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  210,
-  254, 
-  254, 
-  0,
-  64,
-  128,
-  192,
-  210,
-  254, 
-  254, 
-  192,
-  210,
-  254, 
-  254, 
-  52,
-  111,
-  144,
-  192,
-  254, 
-  254, 
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  47,
-  64,
-  108,
-  128,
-  144,
-  192,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  50,
-  64,
-  111,
-  128,
-  144,
-  192,
-  254, 
-  254, 
-  0,
-  52,
-  128,
-  156,
-  210,
-  254, 
-  0,
-  50,
-  192,
-  210,
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  144,
-  192,
-  254, 
-  254, 
-  0,
-  47,
-  64,
-  108,
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  0,
-  52,
-  64,
-  112,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  0,
-  50,
-  64,
-  111,
-  128,
-  149,
-  192,
-  210,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  161,
-  192,
-  210,
-  254, 
-  254, 
-  0,
-  47,
-  64,
-  108,
-  128,
-  148,
-  192,
-  254, 
-  254, 
-  64,
-  104,
-  128,
-  160,
-  210,
-  254, 
-  254, 
-  64,
-  108,
-  128,
-  148,
-  192,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  160,
-  210,
-  254, 
-  254, 
-  0,
-  50,
-  64,
-  111,
-  128,
-  144,
-  192,
-  254, 
-  254, 
-  128,
-  156,
-  210,
-  254, 
-  192,
-  210,
-  254, 
-  0,
-  52,
-  64,
-  112,
-  128,
-  144,
-  192,
-  254, 
-  254, 
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  128,
-  151,
-  192,
-  210,
-  254, 
-  254, 
-  128,
-  152,
-  192,
-  210,
-  254, 
-  254, 
-  0,
-  64,
-  128,
-  154,
-  192,
-  254, 
-  254, 
-  50,
-  105,
-  128,
-  142,
-  210,
-  254, 
-  254, 
-  128,
-  192,
-  254, 
-  254, 
-  0,
-  53,
-  64,
-  109,
-  142,
-  210,
-  254, 
-  254, 
-  0,
-  57,
-  64,
-  112,
-  128,
-  192,
-  254, 
-  254, 
-  64,
-  112,
-  142,
-  210,
-  254, 
-  64,
-  112,
-  192,
-  210,
-  254, 
-  0,
-  55,
-  64,
-  111,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  0,
-  53,
-  64,
-  109,
-  128,
-  145,
-  210,
-  254, 
-  254, 
-  0,
-  52,
-  64,
-  107,
-  128,
-  140,
-  192,
-  254, 
-  254, 
-  128,
-  152,
-  210,
-  254, 
-  254, 
-  128,
-  192,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  104,
-  152,
-  210,
-  254, 
-  254, 
-  0,
-  52,
-  64,
-  107,
-  128,
-  140,
-  192,
-  254, 
-  254, 
-  64,
-  109,
-  128,
-  147,
-  210,
-  254, 
-  64,
-  107,
-  254, 
-  0,
-  50,
-  64,
-  105,
-  128,
-  147,
-  192,
-  210,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  104,
-  128,
-  192,
-  210,
-  254, 
-  254, 
-  0,
-  47,
-  64,
-  108,
-  151,
-  192,
-  254, 
-  254, 
-  64,
-  104,
-  128,
-  163,
-  210,
-  254, 
-  254, 
-  0,
-  47,
-  64,
-  108,
-  128,
-  192,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  163,
-  210,
-  254, 
-  254, 
-  0,
-  50,
-  64,
-  111,
-  128,
-  192,
-  254, 
-  254, 
-  64,
-  108,
-  156,
-  210,
-  254, 
-  192,
-  210,
-  254, 
-  0,
-  52,
-  64,
-  112,
-  128,
-  192,
-  254, 
-  254, 
-  64,
-  108,
-  160,
-  210,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  64,
-  104,
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  210,
-  254, 
-  254, 
-  0,
-  64,
-  128,
-  192,
-  210,
-  254, 
-  254, 
-  192,
-  210,
-  254, 
-  254, 
-  40,
-  100,
-  161,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  254, 
-  128,
-  161,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  254, 
-  0,
-  36,
-  64,
-  97,
-  128,
-  161,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  192,
-  210,
-  254, 
-  128,
-  161,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  254, 
-  0,
-  38,
-  64,
-  99,
-  128,
-  160,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  254, 
-  128,
-  160,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  254, 
-  0,
-  35,
-  64,
-  96,
-  128,
-  160,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  254, 
-  128,
-  160,
-  192,
-  210,
-  254, 
-  254, 
-  128,
-  168,
-  192,
-  210,
-  254, 
-  254, 
-  0,
-  36,
-  64,
-  97,
-  128,
-  161,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  254, 
-  128,
-  161,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  254, 
-  0,
-  33,
-  64,
-  92,
-  128,
-  161,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  192,
-  210,
-  254, 
-  128,
-  161,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  254, 
-  0,
-  32,
-  64,
-  92,
-  128,
-  160,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  254, 
-  128,
-  160,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  254, 
-  0,
-  35,
-  64,
-  96,
-  128,
-  192,
-  254, 
-  254, 
-  210,
-  254, 
-  254, 
-  0,
-  64,
-  192,
-  210,
-  254, 
-  254, 
-  192,
-  210,
-  254, 
-  254, 
-  40,
-  100,
-  161,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  254, 
-  128,
-  161,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  254, 
-  0,
-  36,
-  64,
-  97,
-  128,
-  161,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  192,
-  210,
-  254, 
-  128,
-  161,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  254, 
-  0,
-  38,
-  64,
-  99,
-  128,
-  160,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  254, 
-  128,
-  160,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  254, 
-  0,
-  35,
-  64,
-  96,
-  128,
-  160,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  254, 
-  128,
-  160,
-  192,
-  210,
-  254, 
-  254, 
-  128,
-  168,
-  192,
-  210,
-  254, 
-  254, 
-  0,
-  36,
-  64,
-  97,
-  128,
-  161,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  254, 
-  0,
-  40,
-  64,
-  100,
-  128,
-  161,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  161,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  192,
-  210,
-  254, 
-  128,
-  161,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  254, 
-  0,
-  44,
-  64,
-  102,
-  128,
-  160,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  254, 
-  128,
-  160,
-  192,
-  254, 
-  254, 
-  128,
-  168,
-  210,
-  254, 
-  254, 
-  0,
-  64,
-  128,
-  192,
-  254, 
-  254, 
-  210,
-  254, 
-  254, 
-  192,
-  210,
-  254, 
-  254, 
-  192,
-  210,
-  254, 
-  254, 
-  52,
-  111,
-  144,
-  192,
-  254, 
-  254, 
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  47,
-  64,
-  108,
-  128,
-  144,
-  192,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  50,
-  64,
-  111,
-  128,
-  144,
-  192,
-  254, 
-  254, 
-  0,
-  52,
-  128,
-  156,
-  210,
-  254, 
-  0,
-  50,
-  192,
-  210,
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  144,
-  192,
-  254, 
-  254, 
-  0,
-  47,
-  64,
-  108,
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  0,
-  52,
-  64,
-  112,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  0,
-  50,
-  64,
-  111,
-  128,
-  149,
-  192,
-  210,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  161,
-  192,
-  210,
-  254, 
-  254, 
-  0,
-  47,
-  64,
-  108,
-  128,
-  148,
-  192,
-  254, 
-  254, 
-  64,
-  104,
-  128,
-  160,
-  210,
-  254, 
-  254, 
-  64,
-  108,
-  128,
-  148,
-  192,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  160,
-  210,
-  254, 
-  254, 
-  0,
-  50,
-  64,
-  111,
-  128,
-  144,
-  192,
-  254, 
-  254, 
-  128,
-  156,
-  210,
-  254, 
-  192,
-  210,
-  254, 
-  0,
-  52,
-  64,
-  112,
-  128,
-  144,
-  192,
-  254, 
-  254, 
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  128,
-  151,
-  192,
-  210,
-  254, 
-  254, 
-  128,
-  152,
-  192,
-  210,
-  254, 
-  254, 
-  0,
-  64,
-  128,
-  154,
-  192,
-  254, 
-  254, 
-  50,
-  105,
-  128,
-  142,
-  210,
-  254, 
-  254, 
-  128,
-  192,
-  254, 
-  254, 
-  0,
-  53,
-  64,
-  109,
-  142,
-  210,
-  254, 
-  254, 
-  0,
-  57,
-  64,
-  112,
-  128,
-  192,
-  254, 
-  254, 
-  64,
-  112,
-  142,
-  210,
-  254, 
-  64,
-  112,
-  192,
-  210,
-  254, 
-  0,
-  55,
-  64,
-  111,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  0,
-  53,
-  64,
-  109,
-  128,
-  145,
-  210,
-  254, 
-  254, 
-  0,
-  52,
-  64,
-  107,
-  128,
-  140,
-  192,
-  254, 
-  254, 
-  128,
-  152,
-  210,
-  254, 
-  254, 
-  128,
-  192,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  104,
-  152,
-  210,
-  254, 
-  254, 
-  0,
-  52,
-  64,
-  107,
-  128,
-  140,
-  192,
-  254, 
-  254, 
-  64,
-  109,
-  128,
-  147,
-  210,
-  254, 
-  64,
-  107,
-  254, 
-  0,
-  50,
-  64,
-  105,
-  128,
-  147,
-  192,
-  210,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  104,
-  128,
-  192,
-  210,
-  254, 
-  254, 
-  0,
-  47,
-  64,
-  108,
-  151,
-  192,
-  254, 
-  254, 
-  64,
-  104,
-  128,
-  163,
-  210,
-  254, 
-  254, 
-  0,
-  47,
-  64,
-  108,
-  128,
-  192,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  163,
-  210,
-  254, 
-  254, 
-  0,
-  50,
-  64,
-  111,
-  128,
-  192,
-  254, 
-  254, 
-  64,
-  108,
-  156,
-  210,
-  254, 
-  192,
-  210,
-  254, 
-  0,
-  52,
-  64,
-  112,
-  128,
-  192,
-  254, 
-  254, 
-  64,
-  108,
-  160,
-  210,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  64,
-  104,
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  210,
-  254, 
-  254, 
-  0,
-  64,
-  128,
-  192,
-  210,
-  254, 
-  254, 
-  192,
-  210,
-  254, 
-  254, 
-  52,
-  111,
-  144,
-  192,
-  254, 
-  254, 
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  47,
-  64,
-  108,
-  128,
-  144,
-  192,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  50,
-  64,
-  111,
-  128,
-  144,
-  192,
-  254, 
-  254, 
-  0,
-  52,
-  128,
-  156,
-  210,
-  254, 
-  0,
-  50,
-  192,
-  210,
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  144,
-  192,
-  254, 
-  254, 
-  0,
-  47,
-  64,
-  108,
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  0,
-  52,
-  64,
-  112,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  0,
-  50,
-  64,
-  111,
-  128,
-  149,
-  192,
-  210,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  161,
-  192,
-  210,
-  254, 
-  254, 
-  0,
-  47,
-  64,
-  108,
-  128,
-  148,
-  192,
-  254, 
-  254, 
-  64,
-  104,
-  128,
-  160,
-  210,
-  254, 
-  254, 
-  64,
-  108,
-  128,
-  148,
-  192,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  160,
-  210,
-  254, 
-  254, 
-  0,
-  50,
-  64,
-  111,
-  128,
-  144,
-  192,
-  254, 
-  254, 
-  128,
-  156,
-  210,
-  254, 
-  192,
-  210,
-  254, 
-  0,
-  52,
-  64,
-  112,
-  128,
-  144,
-  192,
-  254, 
-  254, 
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  161,
-  210,
-  254, 
-  254, 
-  128,
-  151,
-  192,
-  210,
-  254, 
-  254, 
-  128,
-  152,
-  192,
-  210,
-  254, 
-  254, 
-  0,
-  64,
-  128,
-  154,
-  192,
-  254, 
-  254, 
-  50,
-  105,
-  128,
-  142,
-  210,
-  254, 
-  254, 
-  128,
-  192,
-  254, 
-  254, 
-  0,
-  53,
-  64,
-  109,
-  142,
-  210,
-  254, 
-  254, 
-  0,
-  57,
-  64,
-  112,
-  128,
-  192,
-  254, 
-  254, 
-  64,
-  112,
-  142,
-  210,
-  254, 
-  64,
-  112,
-  192,
-  210,
-  254, 
-  0,
-  55,
-  64,
-  111,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  0,
-  53,
-  64,
-  109,
-  128,
-  145,
-  210,
-  254, 
-  254, 
-  0,
-  52,
-  64,
-  107,
-  128,
-  140,
-  192,
-  254, 
-  254, 
-  128,
-  152,
-  210,
-  254, 
-  254, 
-  128,
-  192,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  104,
-  152,
-  210,
-  254, 
-  254, 
-  0,
-  52,
-  64,
-  107,
-  128,
-  140,
-  192,
-  254, 
-  254, 
-  64,
-  109,
-  128,
-  147,
-  210,
-  254, 
-  64,
-  107,
-  254, 
-  0,
-  50,
-  64,
-  105,
-  128,
-  147,
-  192,
-  210,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  104,
-  128,
-  192,
-  210,
-  254, 
-  254, 
-  0,
-  47,
-  64,
-  108,
-  151,
-  192,
-  254, 
-  254, 
-  64,
-  104,
-  128,
-  163,
-  210,
-  254, 
-  254, 
-  0,
-  47,
-  64,
-  108,
-  128,
-  192,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  163,
-  210,
-  254, 
-  254, 
-  0,
-  50,
-  64,
-  111,
-  128,
-  192,
-  254, 
-  254, 
-  64,
-  108,
-  156,
-  210,
-  254, 
-  192,
-  210,
-  254, 
-  0,
-  52,
-  64,
-  112,
-  128,
-  192,
-  254, 
-  254, 
-  64,
-  108,
-  160,
-  210,
-  254, 
-  254, 
-  0,
-  48,
-  64,
-  109,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  64,
-  104,
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  128,
-  156,
-  210,
-  254, 
-  254, 
-  0,
-  45,
-  64,
-  104,
-  128,
-  149,
-  192,
-  254, 
-  254, 
-  210,
-  254, 
-  254, 
-  0,
-  64,
-  128,
-  192,
-  210,
-  254, 
-  254, 
-  192,
-  210,
-  254, 
-  254, 
-  192,
+  1, 3, 0, 6, 255, 0, 2, 0, 31, 131, 1, 31, 131, 2, 31, 132,
+  3, 31, 134, 255, 1, 140, 36, 40, 83, 100, 219, 198, 112, 150, 219, 196,
+  35, 197, 80, 198, 100, 199, 219, 196, 36, 197, 81, 198, 112, 150, 219, 196,
+  38, 197, 83, 198, 100, 199, 219, 196, 40, 198, 112, 150, 213, 196, 38, 199,
+  150, 213, 196, 36, 197, 81, 198, 100, 199, 219, 196, 35, 197, 80, 198, 112,
+  150, 219, 196, 33, 197, 76, 198, 105, 199, 219, 198, 117, 150, 219, 196, 33,
+  197, 76, 198, 105, 199, 219, 196, 36, 197, 81, 198, 117, 150, 219, 196, 40,
+  197, 84, 198, 105, 199, 219, 198, 117, 150, 219, 196, 38, 197, 83, 198, 105,
+  199, 150, 219, 196, 36, 197, 81, 198, 117, 199, 150, 219, 196, 35, 197, 80,
+  198, 104, 199, 219, 197, 76, 198, 116, 150, 219, 197, 80, 198, 104, 199, 219,
+  196, 36, 197, 81, 198, 116, 150, 219, 196, 38, 197, 83, 198, 100, 199, 219,
+  198, 112, 150, 213, 199, 150, 213, 196, 40, 197, 84, 198, 100, 199, 219, 198,
+  112, 150, 219, 196, 36, 197, 81, 198, 105, 199, 219, 198, 117, 150, 219, 196,
+  33, 197, 76, 198, 105, 199, 219, 198, 117, 150, 219, 196, 33, 197, 76, 198,
+  105, 199, 219, 198, 117, 150, 219, 198, 107, 199, 150, 219, 198, 108, 199, 150,
+  219, 196, 197, 198, 110, 199, 219, 38, 77, 198, 98, 150, 219, 198, 199, 219,
+  196, 41, 197, 81, 98, 150, 219, 196, 45, 197, 84, 198, 199, 219, 197, 84,
+  98, 150, 213, 197, 84, 199, 150, 213, 196, 43, 197, 83, 198, 105, 199, 219,
+  196, 41, 197, 81, 198, 101, 150, 219, 196, 40, 197, 79, 198, 96, 199, 219,
+  198, 108, 150, 219, 198, 199, 219, 196, 36, 197, 76, 108, 150, 219, 196, 40,
+  197, 79, 198, 96, 199, 219, 197, 81, 198, 103, 150, 213, 197, 79, 213, 196,
+  38, 197, 77, 198, 103, 199, 150, 219, 196, 36, 197, 76, 198, 199, 150, 219,
+  196, 35, 197, 80, 107, 199, 219, 197, 76, 198, 119, 150, 219, 196, 35, 197,
+  80, 198, 199, 219, 196, 36, 197, 81, 119, 150, 219, 196, 38, 197, 83, 198,
+  199, 219, 197, 80, 112, 150, 213, 199, 150, 213, 196, 40, 197, 84, 198, 199,
+  219, 197, 80, 116, 150, 219, 196, 36, 197, 81, 198, 105, 199, 219, 197, 76,
+  198, 112, 150, 219, 196, 33, 197, 76, 198, 105, 199, 219, 198, 112, 150, 219,
+  196, 33, 197, 76, 198, 105, 199, 219, 150, 219, 196, 197, 198, 199, 150, 219,
+  199, 150, 219, 40, 83, 100, 199, 219, 198, 112, 150, 219, 196, 35, 197, 80,
+  198, 100, 199, 219, 196, 36, 197, 81, 198, 112, 150, 219, 196, 38, 197, 83,
+  198, 100, 199, 219, 196, 40, 198, 112, 150, 213, 196, 38, 199, 150, 213, 196,
+  36, 197, 81, 198, 100, 199, 219, 196, 35, 197, 80, 198, 112, 150, 219, 196,
+  33, 197, 76, 198, 105, 199, 219, 198, 117, 150, 219, 196, 33, 197, 76, 198,
+  105, 199, 219, 196, 36, 197, 81, 198, 117, 150, 219, 196, 40, 197, 84, 198,
+  105, 199, 219, 198, 117, 150, 219, 196, 38, 197, 83, 198, 105, 199, 150, 219,
+  196, 36, 197, 81, 198, 117, 199, 150, 219, 196, 35, 197, 80, 198, 104, 199,
+  219, 197, 76, 198, 116, 150, 219, 197, 80, 198, 104, 199, 219, 196, 36, 197,
+  81, 198, 116, 150, 219, 196, 38, 197, 83, 198, 100, 199, 219, 198, 112, 150,
+  213, 199, 150, 213, 196, 40, 197, 84, 198, 100, 199, 219, 198, 112, 150, 219,
+  196, 36, 197, 81, 198, 105, 199, 219, 198, 117, 150, 219, 196, 33, 197, 76,
+  198, 105, 199, 219, 198, 117, 150, 219, 196, 33, 197, 76, 198, 105, 199, 219,
+  198, 117, 150, 219, 198, 107, 199, 150, 219, 198, 108, 199, 150, 219, 196, 197,
+  198, 110, 199, 219, 38, 77, 198, 98, 150, 219, 198, 199, 219, 196, 41, 197,
+  81, 98, 150, 219, 196, 45, 197, 84, 198, 199, 219, 197, 84, 98, 150, 213,
+  197, 84, 199, 150, 213, 196, 43, 197, 83, 198, 105, 199, 219, 196, 41, 197,
+  81, 198, 101, 150, 219, 196, 40, 197, 79, 198, 96, 199, 219, 198, 108, 150,
+  219, 198, 199, 219, 196, 36, 197, 76, 108, 150, 219, 196, 40, 197, 79, 198,
+  96, 199, 219, 197, 81, 198, 103, 150, 213, 197, 79, 213, 196, 38, 197, 77,
+  198, 103, 199, 150, 219, 196, 36, 197, 76, 198, 199, 150, 219, 196, 35, 197,
+  80, 107, 199, 219, 197, 76, 198, 119, 150, 219, 196, 35, 197, 80, 198, 199,
+  219, 196, 36, 197, 81, 119, 150, 219, 196, 38, 197, 83, 198, 199, 219, 197,
+  80, 112, 150, 213, 199, 150, 213, 196, 40, 197, 84, 198, 199, 219, 197, 80,
+  116, 150, 219, 196, 36, 197, 81, 198, 105, 199, 219, 197, 76, 198, 112, 150,
+  219, 196, 33, 197, 76, 198, 105, 199, 219, 198, 112, 150, 219, 196, 33, 197,
+  76, 198, 105, 199, 219, 150, 219, 196, 197, 198, 199, 150, 219, 199, 150, 219,
+  28, 72, 117, 199, 219, 198, 124, 150, 219, 198, 117, 199, 219, 198, 124, 150,
+  219, 196, 24, 197, 69, 198, 117, 199, 219, 198, 124, 150, 213, 199, 150, 213,
+  198, 117, 199, 219, 198, 124, 150, 219, 196, 26, 197, 71, 198, 116, 199, 219,
+  198, 124, 150, 219, 198, 116, 199, 219, 198, 124, 150, 219, 196, 23, 197, 68,
+  198, 116, 199, 219, 198, 124, 150, 219, 198, 116, 199, 150, 219, 198, 124, 199,
+  150, 219, 196, 24, 197, 69, 198, 117, 199, 219, 198, 124, 150, 219, 198, 117,
+  199, 219, 198, 124, 150, 219, 196, 21, 197, 64, 198, 117, 199, 219, 198, 124,
+  150, 213, 199, 150, 213, 198, 117, 199, 219, 198, 124, 150, 219, 196, 20, 197,
+  64, 198, 116, 199, 219, 198, 124, 150, 219, 198, 116, 199, 219, 198, 124, 150,
+  219, 196, 23, 197, 68, 198, 199, 219, 150, 219, 196, 197, 199, 150, 219, 199,
+  150, 219, 28, 72, 117, 199, 219, 198, 124, 150, 219, 198, 117, 199, 219, 198,
+  124, 150, 219, 196, 24, 197, 69, 198, 117, 199, 219, 198, 124, 150, 213, 199,
+  150, 213, 198, 117, 199, 219, 198, 124, 150, 219, 196, 26, 197, 71, 198, 116,
+  199, 219, 198, 124, 150, 219, 198, 116, 199, 219, 198, 124, 150, 219, 196, 23,
+  197, 68, 198, 116, 199, 219, 198, 124, 150, 219, 198, 116, 199, 150, 219, 198,
+  124, 199, 150, 219, 196, 24, 197, 69, 198, 117, 199, 219, 198, 124, 150, 219,
+  196, 28, 197, 72, 198, 117, 199, 219, 198, 124, 150, 219, 196, 33, 197, 76,
+  198, 117, 199, 219, 198, 124, 150, 213, 199, 150, 213, 198, 117, 199, 219, 198,
+  124, 150, 219, 196, 32, 197, 74, 198, 116, 199, 219, 198, 124, 150, 219, 198,
+  116, 199, 219, 198, 124, 150, 219, 196, 197, 198, 199, 219, 150, 219, 199, 150,
+  219, 199, 150, 219, 40, 83, 100, 199, 219, 198, 112, 150, 219, 196, 35, 197,
+  80, 198, 100, 199, 219, 196, 36, 197, 81, 198, 112, 150, 219, 196, 38, 197,
+  83, 198, 100, 199, 219, 196, 40, 198, 112, 150, 213, 196, 38, 199, 150, 213,
+  196, 36, 197, 81, 198, 100, 199, 219, 196, 35, 197, 80, 198, 112, 150, 219,
+  196, 33, 197, 76, 198, 105, 199, 219, 198, 117, 150, 219, 196, 33, 197, 76,
+  198, 105, 199, 219, 196, 36, 197, 81, 198, 117, 150, 219, 196, 40, 197, 84,
+  198, 105, 199, 219, 198, 117, 150, 219, 196, 38, 197, 83, 198, 105, 199, 150,
+  219, 196, 36, 197, 81, 198, 117, 199, 150, 219, 196, 35, 197, 80, 198, 104,
+  199, 219, 197, 76, 198, 116, 150, 219, 197, 80, 198, 104, 199, 219, 196, 36,
+  197, 81, 198, 116, 150, 219, 196, 38, 197, 83, 198, 100, 199, 219, 198, 112,
+  150, 213, 199, 150, 213, 196, 40, 197, 84, 198, 100, 199, 219, 198, 112, 150,
+  219, 196, 36, 197, 81, 198, 105, 199, 219, 198, 117, 150, 219, 196, 33, 197,
+  76, 198, 105, 199, 219, 198, 117, 150, 219, 196, 33, 197, 76, 198, 105, 199,
+  219, 198, 117, 150, 219, 198, 107, 199, 150, 219, 198, 108, 199, 150, 219, 196,
+  197, 198, 110, 199, 219, 38, 77, 198, 98, 150, 219, 198, 199, 219, 196, 41,
+  197, 81, 98, 150, 219, 196, 45, 197, 84, 198, 199, 219, 197, 84, 98, 150,
+  213, 197, 84, 199, 150, 213, 196, 43, 197, 83, 198, 105, 199, 219, 196, 41,
+  197, 81, 198, 101, 150, 219, 196, 40, 197, 79, 198, 96, 199, 219, 198, 108,
+  150, 219, 198, 199, 219, 196, 36, 197, 76, 108, 150, 219, 196, 40, 197, 79,
+  198, 96, 199, 219, 197, 81, 198, 103, 150, 213, 197, 79, 213, 196, 38, 197,
+  77, 198, 103, 199, 150, 219, 196, 36, 197, 76, 198, 199, 150, 219, 196, 35,
+  197, 80, 107, 199, 219, 197, 76, 198, 119, 150, 219, 196, 35, 197, 80, 198,
+  199, 219, 196, 36, 197, 81, 119, 150, 219, 196, 38, 197, 83, 198, 199, 219,
+  197, 80, 112, 150, 213, 199, 150, 213, 196, 40, 197, 84, 198, 199, 219, 197,
+  80, 116, 150, 219, 196, 36, 197, 81, 198, 105, 199, 219, 197, 76, 198, 112,
+  150, 219, 196, 33, 197, 76, 198, 105, 199, 219, 198, 112, 150, 219, 196, 33,
+  197, 76, 198, 105, 199, 219, 150, 219, 196, 197, 198, 199, 150, 219, 199, 150,
+  219, 40, 83, 100, 199, 219, 198, 112, 150, 219, 196, 35, 197, 80, 198, 100,
+  199, 219, 196, 36, 197, 81, 198, 112, 150, 219, 196, 38, 197, 83, 198, 100,
+  199, 219, 196, 40, 198, 112, 150, 213, 196, 38, 199, 150, 213, 196, 36, 197,
+  81, 198, 100, 199, 219, 196, 35, 197, 80, 198, 112, 150, 219, 196, 33, 197,
+  76, 198, 105, 199, 219, 198, 117, 150, 219, 196, 33, 197, 76, 198, 105, 199,
+  219, 196, 36, 197, 81, 198, 117, 150, 219, 196, 40, 197, 84, 198, 105, 199,
+  219, 198, 117, 150, 219, 196, 38, 197, 83, 198, 105, 199, 150, 219, 196, 36,
+  197, 81, 198, 117, 199, 150, 219, 196, 35, 197, 80, 198, 104, 199, 219, 197,
+  76, 198, 116, 150, 219, 197, 80, 198, 104, 199, 219, 196, 36, 197, 81, 198,
+  116, 150, 219, 196, 38, 197, 83, 198, 100, 199, 219, 198, 112, 150, 213, 199,
+  150, 213, 196, 40, 197, 84, 198, 100, 199, 219, 198, 112, 150, 219, 196, 36,
+  197, 81, 198, 105, 199, 219, 198, 117, 150, 219, 196, 33, 197, 76, 198, 105,
+  199, 219, 198, 117, 150, 219, 196, 33, 197, 76, 198, 105, 199, 219, 198, 117,
+  150, 219, 198, 107, 199, 150, 219, 198, 108, 199, 150, 219, 196, 197, 198, 110,
+  199, 219, 38, 77, 198, 98, 150, 219, 198, 199, 219, 196, 41, 197, 81, 98,
+  150, 219, 196, 45, 197, 84, 198, 199, 219, 197, 84, 98, 150, 213, 197, 84,
+  199, 150, 213, 196, 43, 197, 83, 198, 105, 199, 219, 196, 41, 197, 81, 198,
+  101, 150, 219, 196, 40, 197, 79, 198, 96, 199, 219, 198, 108, 150, 219, 198,
+  199, 219, 196, 36, 197, 76, 108, 150, 219, 196, 40, 197, 79, 198, 96, 199,
+  219, 197, 81, 198, 103, 150, 213, 197, 79, 213, 196, 38, 197, 77, 198, 103,
+  199, 150, 219, 196, 36, 197, 76, 198, 199, 150, 219, 196, 35, 197, 80, 107,
+  199, 219, 197, 76, 198, 119, 150, 219, 196, 35, 197, 80, 198, 199, 219, 196,
+  36, 197, 81, 119, 150, 219, 196, 38, 197, 83, 198, 199, 219, 197, 80, 112,
+  150, 213, 199, 150, 213, 196, 40, 197, 84, 198, 199, 219, 197, 80, 116, 150,
+  219, 196, 36, 197, 81, 198, 105, 199, 219, 197, 76, 198, 112, 150, 219, 196,
+  33, 197, 76, 198, 105, 199, 219, 198, 112, 150, 219, 196, 33, 197, 76, 198,
+  105, 199, 219, 150, 219, 196, 197, 198, 199, 150, 219, 199, 150, 219, 199, 255,
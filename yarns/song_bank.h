@@ -0,0 +1,215 @@
+// Copyright 2013 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Song bank: songs and multi snapshots stored in flash, read incrementally.
+//
+// Bank layout:
+//   1 byte: number of entries.
+//   2 bytes per entry (little endian): offset of the entry from the start of
+//     the bank.
+//
+// Entry layout:
+//   1 byte: number of settings.
+//   3 bytes per setting: target (part index, or 0xff for the multi), address
+//     and value, as accepted by Part::Set() and Multi::Set().
+//   1 byte: base note of the short note on events.
+//   Event stream, terminated by 0xff. An entry whose stream is empty only
+//   holds a multi snapshot. Otherwise, the stream must contain at least one
+//   wait.
+//
+// Event stream bytes:
+//   0x00 - 0xbf: note on, for part byte / 48 and note base + byte % 48.
+//   0xc0 - 0xc3 nn: note on for note nn, for part byte & 3.
+//   0xc4 - 0xc7: all notes off, for part byte & 3.
+//   0xc8 - 0xcb nn: note off for note nn, for part byte & 3.
+//   0xcc vv: set the velocity of the following note on events.
+//   0xd0 - 0xfe: wait for 1 to 47 clock ticks before the next event.
+//   0xff: end of the song, loop back to the first event.
+//
+// Times are delta-encoded, and most events fit in one byte. A song is read
+// incrementally, straight from flash, without any RAM copy.
+
+#ifndef YARNS_SONG_BANK_H_
+#define YARNS_SONG_BANK_H_
+
+#include "stmlib/stmlib.h"
+
+namespace yarns {
+
+const uint8_t kSongTargetMulti = 0xff;
+const uint8_t kSongDefaultVelocity = 100;
+const uint8_t kSongShortNoteRange = 48;
+
+enum SongOpcode {
+  SONG_OPCODE_NOTE_ON = 0xc0,
+  SONG_OPCODE_ALL_NOTES_OFF = 0xc4,
+  SONG_OPCODE_NOTE_OFF = 0xc8,
+  SONG_OPCODE_VELOCITY = 0xcc,
+  SONG_OPCODE_WAIT = 0xd0,
+  SONG_OPCODE_END = 0xff
+};
+
+const uint8_t kSongMaxWait = SONG_OPCODE_END - SONG_OPCODE_WAIT;
+
+enum SongEventType {
+  SONG_EVENT_NOTE_ON,
+  SONG_EVENT_NOTE_OFF,
+  SONG_EVENT_ALL_NOTES_OFF
+};
+
+struct SongEvent {
+  uint8_t type;
+  uint8_t part;
+  uint8_t note;
+  uint8_t velocity;
+};
+
+class SongBank {
+ public:
+  SongBank() { }
+  ~SongBank() { }
+  
+  void Init(const uint8_t* data) {
+    data_ = data;
+  }
+  
+  inline uint8_t num_entries() const { return data_[0]; }
+  
+  inline uint8_t num_settings(uint8_t entry) const {
+    return entry_data(entry)[0];
+  }
+  
+  // Returns a pointer to the target, address and value bytes.
+  inline const uint8_t* setting(uint8_t entry, uint8_t index) const {
+    return &entry_data(entry)[1 + 3 * index];
+  }
+  
+  inline uint8_t base_note(uint8_t entry) const {
+    return *setting(entry, num_settings(entry));
+  }
+  
+  inline const uint8_t* events(uint8_t entry) const {
+    return setting(entry, num_settings(entry)) + 1;
+  }
+  
+ private:
+  inline const uint8_t* entry_data(uint8_t entry) const {
+    const uint8_t* offset = &data_[1 + 2 * entry];
+    return &data_[offset[0] | (offset[1] << 8)];
+  }
+  
+  const uint8_t* data_;
+  
+  DISALLOW_COPY_AND_ASSIGN(SongBank);
+};
+
+class SongReader {
+ public:
+  SongReader() { }
+  ~SongReader() { }
+  
+  void Init() {
+    Stop();
+  }
+  
+  void Start(const uint8_t* events, uint8_t base_note) {
+    events_ = *events == SONG_OPCODE_END ? NULL : events;
+    base_note_ = base_note;
+    wait_ = 0;
+    Rewind();
+  }
+  
+  void Stop() {
+    events_ = ptr_ = NULL;
+  }
+  
+  // Reads the next event due at the current clock tick. Returns false once
+  // all the events of the tick have been read.
+  bool Read(SongEvent* e) {
+    if (!events_ || wait_) {
+      return false;
+    }
+    while (true) {
+      uint8_t byte = *ptr_++;
+      if (byte < SONG_OPCODE_NOTE_ON) {
+        e->type = SONG_EVENT_NOTE_ON;
+        e->part = byte / kSongShortNoteRange;
+        e->note = base_note_ + byte % kSongShortNoteRange;
+        e->velocity = velocity_;
+        return true;
+      } else if (byte < SONG_OPCODE_ALL_NOTES_OFF) {
+        e->type = SONG_EVENT_NOTE_ON;
+        e->part = byte & 3;
+        e->note = *ptr_++;
+        e->velocity = velocity_;
+        return true;
+      } else if (byte < SONG_OPCODE_NOTE_OFF) {
+        e->type = SONG_EVENT_ALL_NOTES_OFF;
+        e->part = byte & 3;
+        return true;
+      } else if (byte < SONG_OPCODE_VELOCITY) {
+        e->type = SONG_EVENT_NOTE_OFF;
+        e->part = byte & 3;
+        e->note = *ptr_++;
+        return true;
+      } else if (byte == SONG_OPCODE_VELOCITY) {
+        velocity_ = *ptr_++;
+      } else if (byte == SONG_OPCODE_END) {
+        Rewind();
+      } else if (byte >= SONG_OPCODE_WAIT) {
+        wait_ = byte - SONG_OPCODE_WAIT + 1;
+        return false;
+      }
+    }
+  }
+  
+  // Called once per clock tick, after the events of the tick have been read.
+  inline void Tick() {
+    if (wait_) {
+      --wait_;
+    }
+  }
+  
+  inline bool playing() const { return events_ != NULL; }
+  
+ private:
+  inline void Rewind() {
+    ptr_ = events_;
+    velocity_ = kSongDefaultVelocity;
+  }
+  
+  const uint8_t* events_;
+  const uint8_t* ptr_;
+  uint8_t base_note_;
+  uint8_t wait_;
+  uint8_t velocity_;
+  
+  DISALLOW_COPY_AND_ASSIGN(SongReader);
+};
+
+}  // namespace yarns
+
+#endif  // YARNS_SONG_BANK_H_
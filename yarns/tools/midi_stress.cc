@@ -0,0 +1,245 @@
+// Copyright 2013 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Stress test for the MIDI queues.
+//
+// Usage: midi_stress [duration in seconds]
+//
+// The firmware timing is simulated at the SysTick rate (8kHz): the UART
+// receives or transmits one byte every 320us (31250 bps), and the main loop
+// consumes the input and produces the output, except when it is stalled for
+// a while (flash writes, display updates...).
+//
+// Input: a continuous stream of note messages is received at full MIDI rate.
+// For each main loop stall duration, prints the fraction of bytes dropped and
+// the latency between reception and parsing.
+//
+// Output: the main loop sends chords faster than the MIDI bandwidth, while a
+// clock is running. Checks that no message is torn by the overflow, and prints
+// the fraction of messages dropped and the worst clock latency.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+
+#include "yarns/midi_handler.h"
+#include "yarns/multi.h"
+#include "yarns/settings.h"
+
+using namespace std;
+using namespace yarns;
+
+const uint32_t kSysTickRate = 8000;
+const uint32_t kMidiByteRate = 3125;
+const uint32_t kStallPeriod = kSysTickRate / 10;  // A stall every 100ms.
+const uint32_t kClockPeriod = kSysTickRate * 60 / (240 * 24);  // 240 BPM.
+const uint32_t kChordPeriod = kSysTickRate / 200;
+const uint8_t kChordSize = 8;
+
+// Simulates the reception of a byte at the MIDI rate.
+class Uart {
+ public:
+  Uart() : phase_(0) { }
+
+  bool Tick() {
+    phase_ += kMidiByteRate;
+    if (phase_ >= kSysTickRate) {
+      phase_ -= kSysTickRate;
+      return true;
+    }
+    return false;
+  }
+
+ private:
+  uint32_t phase_;
+};
+
+inline bool stalled(uint32_t tick, uint32_t stall) {
+  return (tick % kStallPeriod) < stall;
+}
+
+inline float ticks_to_ms(double ticks) {
+  return 1000.0 * ticks / kSysTickRate;
+}
+
+void TestInput(uint32_t duration, uint32_t stall) {
+  MidiHandler::MidiBuffer queue;
+  queue.Init();
+  deque<uint32_t> timestamps;
+  Uart uart;
+
+  uint32_t received = 0;
+  uint32_t parsed = 0;
+  double total_latency = 0.0;
+  uint32_t max_latency = 0;
+  uint8_t note = 0;
+
+  for (uint32_t tick = 0; tick < duration; ++tick) {
+    // SysTick: the byte received by the UART is pushed into the queue.
+    if (uart.Tick()) {
+      uint8_t byte = received % 3 == 0
+          ? 0x90
+          : (received % 3 == 1 ? (note++ & 0x7f) : 100);
+      if (queue.Write(byte)) {
+        timestamps.push_back(tick);
+      }
+      ++received;
+    }
+
+    // Main loop: the queue is drained in bursts.
+    if (!stalled(tick, stall)) {
+      uint8_t bytes[kMidiInputBurstSize];
+      size_t size;
+      while ((size = queue.Read(bytes, kMidiInputBurstSize)) != 0) {
+        for (size_t i = 0; i < size; ++i) {
+          uint32_t latency = tick - timestamps.front();
+          timestamps.pop_front();
+          total_latency += latency;
+          max_latency = max(max_latency, latency);
+          ++parsed;
+        }
+      }
+    }
+  }
+
+  printf("%8.1f %10u %8u %8.3f%% %8.2f %8.2f\n",
+         ticks_to_ms(stall),
+         received,
+         queue.overflows(),
+         100.0f * queue.overflows() / received,
+         ticks_to_ms(parsed ? total_latency / parsed : 0.0),
+         ticks_to_ms(max_latency));
+}
+
+// Checks the transmitted bytes: each channel message must have the expected
+// number of data bytes, with only realtime messages interleaved.
+class OutputChecker {
+ public:
+  OutputChecker() : expected_(0), torn_(0), messages_(0) { }
+
+  void Push(uint8_t byte) {
+    if (byte >= 0xf8) {
+      return;
+    }
+    if (byte & 0x80) {
+      torn_ += expected_ != 0;
+      expected_ = 2;
+    } else if (expected_) {
+      --expected_;
+      messages_ += expected_ == 0;
+    } else {
+      ++torn_;
+    }
+  }
+
+  uint32_t torn() const { return torn_; }
+  uint32_t messages() const { return messages_; }
+
+ private:
+  uint8_t expected_;
+  uint32_t torn_;
+  uint32_t messages_;
+};
+
+void TestOutput(uint32_t duration, uint32_t stall) {
+  settings.Init();
+  multi.Init();
+  midi_handler.Init();
+
+  Uart uart;
+  OutputChecker checker;
+  deque<uint32_t> clock_timestamps;
+  uint32_t sent = 0;
+  uint32_t max_clock_latency = 0;
+  MidiHandler::SmallMidiBuffer* clock_queue =
+      midi_handler.mutable_high_priority_output_buffer();
+
+  for (uint32_t tick = 0; tick < duration; ++tick) {
+    // SysTick: the UART is ready for a new byte.
+    if (uart.Tick()) {
+      uint8_t byte;
+      if (midi_handler.PopOutputByte(&byte)) {
+        if (byte == 0xf8) {
+          uint32_t latency = tick - clock_timestamps.front();
+          clock_timestamps.pop_front();
+          max_clock_latency = max(max_clock_latency, latency);
+        }
+        checker.Push(byte);
+      }
+    }
+
+    // Main loop: sends chords and clock ticks. When the main loop is stalled,
+    // the messages are all sent at once when it resumes.
+    if (!stalled(tick, stall)) {
+      uint32_t first = tick - (tick % kStallPeriod == stall ? stall : 0);
+      for (uint32_t t = first; t <= tick; ++t) {
+        if (t % kClockPeriod == 0) {
+          size_t queued = clock_queue->readable();
+          midi_handler.OnClock();
+          if (clock_queue->readable() != queued) {
+            clock_timestamps.push_back(tick);
+          }
+        }
+        if (t % kChordPeriod == 0) {
+          for (uint8_t i = 0; i < kChordSize; ++i) {
+            midi_handler.OnInternalNoteOn(i & 3, 48 + i, 100);
+            sent += 1;
+          }
+        }
+      }
+    }
+  }
+
+  printf("%8.1f %10u %8u %8.3f%% %8u %8.2f\n",
+         ticks_to_ms(stall),
+         sent,
+         midi_handler.output_overflows(),
+         100.0f * midi_handler.output_overflows() / sent,
+         checker.torn(),
+         ticks_to_ms(max_clock_latency));
+}
+
+int main(int argc, char** argv) {
+  uint32_t duration = kSysTickRate * (argc >= 2 ? atoi(argv[1]) : 60);
+  const uint32_t stalls[] = { 0, 8, 40, 80, 160, 240, 320, 400 };
+  const size_t num_stalls = sizeof(stalls) / sizeof(stalls[0]);
+
+  printf("Input, %d bytes/s\n", kMidiByteRate);
+  printf("%8s %10s %8s %9s %8s %8s\n",
+         "stall ms", "bytes", "dropped", "rate", "avg ms", "max ms");
+  for (size_t i = 0; i < num_stalls; ++i) {
+    TestInput(duration, stalls[i]);
+  }
+
+  printf("\nOutput, %d messages/s\n", kChordSize * kSysTickRate / kChordPeriod);
+  printf("%8s %10s %8s %9s %8s %8s\n",
+         "stall ms", "messages", "dropped", "rate", "torn", "clock ms");
+  for (size_t i = 0; i < num_stalls; ++i) {
+    TestOutput(duration, stalls[i]);
+  }
+  return 0;
+}
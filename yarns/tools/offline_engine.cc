@@ -0,0 +1,148 @@
+// Copyright 2024 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Host-side Yarns engine, driven by time-stamped MIDI events.
+
+#include "yarns/tools/offline_engine.h"
+
+#include <algorithm>
+
+#include "yarns/midi_handler.h"
+#include "yarns/settings.h"
+
+namespace yarns {
+
+using namespace std;
+
+const uint32_t kClockTicksPerSample = kInternalClockRate / kControlRate;
+
+static bool EarlierThan(const TimedMidiEvent& a, const TimedMidiEvent& b) {
+  return a.time < b.time;
+}
+
+void OfflineEngine::Init() {
+  settings.Init();
+  multi.Init();
+  midi_handler.Init();
+  events_.clear();
+  next_event_ = 0;
+  time_ = 0;
+}
+
+void OfflineEngine::Schedule(const TimedMidiEvent* events, size_t size) {
+  // Drop the events already dispatched, then merge the new batch with the
+  // pending ones. The merge is stable, so simultaneous events keep the order
+  // in which they were submitted.
+  events_.erase(events_.begin(), events_.begin() + next_event_);
+  next_event_ = 0;
+  size_t middle = events_.size();
+  events_.insert(events_.end(), events, events + size);
+  inplace_merge(
+      events_.begin(),
+      events_.begin() + middle,
+      events_.end(),
+      EarlierThan);
+}
+
+void OfflineEngine::Render(CvGateFrame* out, size_t size) {
+  while (size--) {
+    while (next_event_ < events_.size() &&
+           events_[next_event_].time <= time_) {
+      Dispatch(events_[next_event_++]);
+    }
+    for (uint32_t i = 0; i < kClockTicksPerSample; ++i) {
+      multi.RefreshInternalClock();
+    }
+    multi.ProcessInternalClockEvents();
+    multi.Refresh();
+    multi.GetCvGate(out->cv, out->gate);
+    
+    // Nothing is listening to the MIDI output.
+    midi_handler.mutable_output_buffer()->Flush();
+    midi_handler.mutable_high_priority_output_buffer()->Flush();
+    ++out;
+    ++time_;
+  }
+}
+
+void OfflineEngine::Dispatch(const TimedMidiEvent& e) {
+  uint8_t channel = e.status & 0x0f;
+  switch (e.status & 0xf0) {
+    case 0x80:
+      MidiHandler::NoteOff(channel, e.data[0], e.data[1]);
+      break;
+    case 0x90:
+      if (e.data[1]) {
+        MidiHandler::NoteOn(channel, e.data[0], e.data[1]);
+      } else {
+        MidiHandler::NoteOff(channel, e.data[0], 0);
+      }
+      break;
+    case 0xa0:
+      MidiHandler::Aftertouch(channel, e.data[0], e.data[1]);
+      break;
+    case 0xb0:
+      MidiHandler::ControlChange(channel, e.data[0], e.data[1]);
+      break;
+    case 0xc0:
+      MidiHandler::ProgramChange(channel, e.data[0]);
+      break;
+    case 0xd0:
+      MidiHandler::Aftertouch(channel, e.data[0]);
+      break;
+    case 0xe0:
+      MidiHandler::PitchBend(channel, e.data[0] | (e.data[1] << 7));
+      break;
+    case 0xf0:
+      switch (e.status) {
+        case 0xf0:
+          MidiHandler::SysExStart();
+          for (uint16_t i = 0; i < e.sysex_size; ++i) {
+            MidiHandler::SysExByte(e.sysex[i]);
+          }
+          MidiHandler::SysExEnd();
+          break;
+        case 0xf8:
+          MidiHandler::Clock();
+          break;
+        case 0xfa:
+          MidiHandler::Start();
+          break;
+        case 0xfb:
+          MidiHandler::Continue();
+          break;
+        case 0xfc:
+          MidiHandler::Stop();
+          break;
+        case 0xff:
+          MidiHandler::Reset();
+          break;
+      }
+      break;
+  }
+}
+
+}  // namespace yarns
@@ -0,0 +1,103 @@
+// Copyright 2024 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Host-side Yarns engine, driven by time-stamped MIDI events.
+//
+// The events are dispatched directly to the MidiHandler callbacks: there is no
+// UART, input ring buffer or byte-level parser in the path. The engine then
+// runs the same refresh sequence as the firmware - internal clock at 48kHz,
+// Multi::Refresh() and Multi::GetCvGate() at 8kHz - and writes the CV and gate
+// of each control-rate sample to the output buffer.
+//
+// The engine drives the global multi and midi_handler objects, so there can
+// be only one per process. Voices in audio mode are not rendered.
+
+#ifndef YARNS_TOOLS_OFFLINE_ENGINE_H_
+#define YARNS_TOOLS_OFFLINE_ENGINE_H_
+
+#include "stmlib/stmlib.h"
+
+#include <vector>
+
+#include "yarns/multi.h"
+
+namespace yarns {
+
+const uint32_t kControlRate = 8000;
+const uint32_t kInternalClockRate = 48000;
+
+struct TimedMidiEvent {
+  uint32_t time;  // In control-rate samples.
+  uint8_t status;
+  uint8_t data[2];
+  // For SysEx events (status 0xf0): the payload, without the 0xf0 and 0xf7
+  // bytes. Not copied, must outlive the call to Render().
+  const uint8_t* sysex;
+  uint16_t sysex_size;
+};
+
+struct CvGateFrame {
+  uint16_t cv[kNumVoices];
+  bool gate[kNumVoices];
+};
+
+class OfflineEngine {
+ public:
+  OfflineEngine() { }
+  ~OfflineEngine() { }
+  
+  void Init();
+  
+  // Queues a batch of events. Each batch must be sorted by time; batches can
+  // be submitted in any order. Events scheduled before the current time are
+  // dispatched at the beginning of the next rendered sample.
+  void Schedule(const TimedMidiEvent* events, size_t size);
+  
+  // Renders the next size control-rate samples.
+  void Render(CvGateFrame* out, size_t size);
+  
+  inline uint32_t time() const { return time_; }
+  inline size_t num_pending_events() const {
+    return events_.size() - next_event_;
+  }
+  inline uint32_t last_event_time() const {
+    return events_.empty() ? 0 : events_.back().time;
+  }
+  inline Multi* mutable_multi() { return &multi; }
+  
+ private:
+  void Dispatch(const TimedMidiEvent& e);
+  
+  std::vector<TimedMidiEvent> events_;
+  size_t next_event_;
+  uint32_t time_;
+  
+  DISALLOW_COPY_AND_ASSIGN(OfflineEngine);
+};
+
+}  // namespace yarns
+
+#endif  // YARNS_TOOLS_OFFLINE_ENGINE_H_
@@ -0,0 +1,249 @@
+// Copyright 2013 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Standard MIDI File reader for the host tools.
+
+#include "yarns/tools/smf_file.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace yarns {
+
+using namespace std;
+
+class SmfReader {
+ public:
+  SmfReader(const uint8_t* data, size_t size)
+      : data_(data),
+        size_(size),
+        position_(0),
+        error_(false) { }
+  
+  inline uint8_t Byte() {
+    if (position_ >= size_) {
+      error_ = true;
+      return 0;
+    }
+    return data_[position_++];
+  }
+  
+  inline uint32_t BigEndian(size_t num_bytes) {
+    uint32_t value = 0;
+    while (num_bytes--) {
+      value = (value << 8) | Byte();
+    }
+    return value;
+  }
+  
+  inline uint32_t VariableLength() {
+    uint32_t value = 0;
+    for (size_t i = 0; i < 4; ++i) {
+      uint8_t byte = Byte();
+      value = (value << 7) | (byte & 0x7f);
+      if (!(byte & 0x80)) {
+        return value;
+      }
+    }
+    error_ = true;
+    return value;
+  }
+  
+  inline void Skip(size_t num_bytes) {
+    if (num_bytes > size_ - position_) {
+      error_ = true;
+      position_ = size_;
+    } else {
+      position_ += num_bytes;
+    }
+  }
+  
+  inline bool Tag(const char* tag) {
+    if (size_ - position_ < 4 || memcmp(&data_[position_], tag, 4)) {
+      return false;
+    }
+    position_ += 4;
+    return true;
+  }
+  
+  inline const uint8_t* here() const { return &data_[position_]; }
+  inline size_t position() const { return position_; }
+  inline size_t remaining() const { return size_ - position_; }
+  inline bool error() const { return error_; }
+  
+ private:
+  const uint8_t* data_;
+  size_t size_;
+  size_t position_;
+  bool error_;
+};
+
+static bool ParseTrack(
+    const uint8_t* data,
+    size_t size,
+    uint32_t* end_tick,
+    vector<SmfEvent>* events,
+    vector<TempoChange>* tempo_map,
+    vector<uint8_t>* sysex) {
+  SmfReader reader(data, size);
+  uint32_t tick = 0;
+  uint8_t running_status = 0;
+  while (reader.remaining() && !reader.error()) {
+    tick += reader.VariableLength();
+    uint8_t status = reader.Byte();
+    if (status == 0xff) {
+      uint8_t type = reader.Byte();
+      uint32_t length = reader.VariableLength();
+      if (type == 0x2f) {
+        break;
+      } else if (type == 0x51 && length == 3) {
+        TempoChange t;
+        t.tick = tick;
+        t.tempo = reader.BigEndian(3);
+        tempo_map->push_back(t);
+      } else {
+        reader.Skip(length);
+      }
+    } else if (status == 0xf0 || status == 0xf7) {
+      // 0xf7 "escape" packets are sent as is, only complete 0xf0 messages
+      // are forwarded to the engine.
+      uint32_t length = reader.VariableLength();
+      if (status == 0xf0 && length && length <= reader.remaining()) {
+        SmfEvent e;
+        e.tick = tick;
+        e.status = 0xf0;
+        e.data[0] = e.data[1] = 0;
+        e.sysex_offset = sysex->size();
+        e.sysex_size = length - 1;  // Without the trailing 0xf7.
+        sysex->insert(sysex->end(), reader.here(), reader.here() + length - 1);
+        events->push_back(e);
+      }
+      reader.Skip(length);
+      running_status = 0;
+    } else {
+      SmfEvent e;
+      e.tick = tick;
+      e.sysex_offset = 0;
+      e.sysex_size = 0;
+      if (status & 0x80) {
+        running_status = status;
+        e.data[0] = reader.Byte();
+      } else if (running_status) {
+        e.data[0] = status;
+      } else {
+        return false;
+      }
+      e.status = running_status;
+      uint8_t type = running_status & 0xf0;
+      e.data[1] = (type == 0xc0 || type == 0xd0) ? 0 : reader.Byte();
+      events->push_back(e);
+    }
+  }
+  *end_tick = tick;
+  return !reader.error();
+}
+
+static bool EventEarlierThan(const SmfEvent& a, const SmfEvent& b) {
+  return a.tick < b.tick;
+}
+
+static bool TempoChangeEarlierThan(const TempoChange& a, const TempoChange& b) {
+  return a.tick < b.tick;
+}
+
+bool ReadSmfFile(const char* file_name, SmfFile* smf) {
+  FILE* fp = fopen(file_name, "rb");
+  if (!fp) {
+    return false;
+  }
+  vector<uint8_t> file;
+  uint8_t buffer[4096];
+  size_t n;
+  while ((n = fread(buffer, 1, sizeof(buffer), fp)) > 0) {
+    file.insert(file.end(), buffer, buffer + n);
+  }
+  fclose(fp);
+  if (file.empty()) {
+    return false;
+  }
+  
+  SmfReader reader(&file[0], file.size());
+  if (!reader.Tag("MThd") || reader.BigEndian(4) != 6) {
+    return false;
+  }
+  uint16_t format = reader.BigEndian(2);
+  uint16_t num_tracks = reader.BigEndian(2);
+  uint16_t division = reader.BigEndian(2);
+  if (format > 1 || (division & 0x8000) || !division) {
+    return false;
+  }
+  
+  smf->division = division;
+  smf->end_tick = 0;
+  smf->events.clear();
+  smf->tempo_map.clear();
+  smf->sysex.clear();
+  vector<SmfEvent>& events = smf->events;
+  for (uint16_t i = 0; i < num_tracks && reader.remaining(); ++i) {
+    bool is_track = reader.Tag("MTrk");
+    if (!is_track) {
+      reader.Skip(4);
+    }
+    uint32_t length = reader.BigEndian(4);
+    if (reader.error() || length > reader.remaining()) {
+      return false;
+    }
+    if (is_track) {
+      vector<SmfEvent> track_events;
+      uint32_t end_tick;
+      if (!ParseTrack(
+              reader.here(),
+              length,
+              &end_tick,
+              &track_events,
+              &smf->tempo_map,
+              &smf->sysex)) {
+        return false;
+      }
+      smf->end_tick = max(smf->end_tick, end_tick);
+      // Tracks are merged in file order for simultaneous events.
+      size_t middle = events.size();
+      events.insert(events.end(), track_events.begin(), track_events.end());
+      inplace_merge(
+          events.begin(), events.begin() + middle, events.end(),
+          EventEarlierThan);
+    }
+    reader.Skip(length);
+  }
+  stable_sort(
+      smf->tempo_map.begin(),
+      smf->tempo_map.end(),
+      TempoChangeEarlierThan);
+  return true;
+}
+
+}  // namespace yarns
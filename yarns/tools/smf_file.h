@@ -0,0 +1,66 @@
+// Copyright 2013 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Standard MIDI File reader for the host tools.
+
+#ifndef YARNS_TOOLS_SMF_FILE_H_
+#define YARNS_TOOLS_SMF_FILE_H_
+
+#include "stmlib/stmlib.h"
+
+#include <vector>
+
+namespace yarns {
+
+const uint32_t kSmfDefaultTempo = 500000;  // Microseconds per quarter note.
+
+struct SmfEvent {
+  uint32_t tick;
+  uint8_t status;
+  uint8_t data[2];
+  uint32_t sysex_offset;
+  uint16_t sysex_size;
+};
+
+struct TempoChange {
+  uint32_t tick;
+  uint32_t tempo;
+};
+
+struct SmfFile {
+  uint16_t division;  // Ticks per quarter note.
+  uint32_t end_tick;  // End of the longest track.
+  std::vector<SmfEvent> events;  // All tracks, merged and sorted by tick.
+  std::vector<TempoChange> tempo_map;
+  std::vector<uint8_t> sysex;  // SysEx payloads, without 0xf0 and 0xf7.
+};
+
+// Reads a format 0 or 1 file, with a metrical time division.
+bool ReadSmfFile(const char* file_name, SmfFile* smf);
+
+}  // namespace yarns
+
+#endif  // YARNS_TOOLS_SMF_FILE_H_
@@ -0,0 +1,161 @@
+// Copyright 2024 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Renders the CV and gate outputs of Yarns for a Standard MIDI File.
+//
+// Usage: smf_renderer song.mid out.wav [layout]
+//
+// The output is an 8-channel, 16-bit WAV file at the 8kHz refresh rate of the
+// module: the 4 CV outputs (DAC code, offset to signed), then the 4 gates.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "yarns/tools/offline_engine.h"
+#include "yarns/tools/smf_file.h"
+
+using namespace std;
+using namespace yarns;
+
+const uint32_t kTailDuration = 2 * kControlRate;
+const size_t kRenderBlockSize = 1024;
+const size_t kNumChannels = 2 * kNumVoices;
+
+// Converts ticks to control-rate samples, walking the tempo map.
+void ConvertEvents(const SmfFile& smf, vector<TimedMidiEvent>* timed_events) {
+  const vector<SmfEvent>& events = smf.events;
+  const vector<TempoChange>& tempo_map = smf.tempo_map;
+  uint16_t division = smf.division;
+  double time = 0.0;
+  uint32_t tick = 0;
+  uint32_t tempo = kSmfDefaultTempo;
+  size_t tempo_index = 0;
+  for (size_t i = 0; i < events.size(); ++i) {
+    const SmfEvent& e = events[i];
+    while (tempo_index < tempo_map.size() &&
+           tempo_map[tempo_index].tick <= e.tick) {
+      time += double(tempo_map[tempo_index].tick - tick) * tempo / division;
+      tick = tempo_map[tempo_index].tick;
+      tempo = tempo_map[tempo_index].tempo;
+      ++tempo_index;
+    }
+    double t = time + double(e.tick - tick) * tempo / division;
+    TimedMidiEvent timed;
+    timed.time = static_cast<uint32_t>(t * kControlRate / 1e6 + 0.5);
+    timed.status = e.status;
+    timed.data[0] = e.data[0];
+    timed.data[1] = e.data[1];
+    timed.sysex = e.sysex_size ? &smf.sysex[e.sysex_offset] : NULL;
+    timed.sysex_size = e.sysex_size;
+    timed_events->push_back(timed);
+  }
+}
+
+void WriteWavHeader(FILE* fp, uint32_t num_frames) {
+  uint32_t l;
+  uint16_t s;
+  
+  fwrite("RIFF", 4, 1, fp);
+  l = 36 + num_frames * kNumChannels * 2;
+  fwrite(&l, 4, 1, fp);
+  fwrite("WAVE", 4, 1, fp);
+  
+  fwrite("fmt ", 4, 1, fp);
+  l = 16;
+  fwrite(&l, 4, 1, fp);
+  s = 1;
+  fwrite(&s, 2, 1, fp);
+  s = kNumChannels;
+  fwrite(&s, 2, 1, fp);
+  l = kControlRate;
+  fwrite(&l, 4, 1, fp);
+  l = kControlRate * kNumChannels * 2;
+  fwrite(&l, 4, 1, fp);
+  s = kNumChannels * 2;
+  fwrite(&s, 2, 1, fp);
+  s = 16;
+  fwrite(&s, 2, 1, fp);
+  
+  fwrite("data", 4, 1, fp);
+  l = num_frames * kNumChannels * 2;
+  fwrite(&l, 4, 1, fp);
+}
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    fprintf(stderr, "Usage: %s song.mid out.wav [layout]\n", argv[0]);
+    return 1;
+  }
+  
+  SmfFile smf;
+  if (!ReadSmfFile(argv[1], &smf)) {
+    fprintf(stderr, "Could not read %s\n", argv[1]);
+    return 1;
+  }
+  vector<TimedMidiEvent> events;
+  ConvertEvents(smf, &events);
+  
+  static OfflineEngine engine;
+  engine.Init();
+  if (argc >= 4) {
+    engine.mutable_multi()->Set(MULTI_LAYOUT, atoi(argv[3]));
+  }
+  if (!events.empty()) {
+    engine.Schedule(&events[0], events.size());
+  }
+  
+  FILE* fp = fopen(argv[2], "wb");
+  if (!fp) {
+    fprintf(stderr, "Could not write %s\n", argv[2]);
+    return 1;
+  }
+  uint32_t num_frames = engine.last_event_time() + kTailDuration;
+  WriteWavHeader(fp, num_frames);
+  
+  CvGateFrame frames[kRenderBlockSize];
+  int16_t samples[kRenderBlockSize * kNumChannels];
+  uint32_t remaining = num_frames;
+  while (remaining) {
+    size_t size = min(static_cast<size_t>(remaining), kRenderBlockSize);
+    engine.Render(frames, size);
+    int16_t* s = samples;
+    for (size_t i = 0; i < size; ++i) {
+      for (size_t j = 0; j < kNumVoices; ++j) {
+        *s++ = static_cast<int16_t>(frames[i].cv[j] - 32768);
+      }
+      for (size_t j = 0; j < kNumVoices; ++j) {
+        *s++ = frames[i].gate[j] ? 32767 : 0;
+      }
+    }
+    fwrite(samples, sizeof(int16_t), size * kNumChannels, fp);
+    remaining -= size;
+  }
+  fclose(fp);
+  printf("%lu events, %u frames\n", events.size(), num_frames);
+  return 0;
+}
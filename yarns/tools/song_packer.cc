@@ -0,0 +1,200 @@
+// Copyright 2013 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Packs Standard MIDI Files into a song bank (see yarns/song_bank.h).
+//
+// Usage: song_packer bank.h song.mid [song.mid ...]
+//
+// MIDI channels 1 to 4 are played by parts 1 to 4, the other channels are
+// ignored. Events are quantized to the 24 ppqn resolution of the clock. The
+// layout is selected from the number of channels used, the tempo from the
+// first tempo change, and each song loops at the end of its longest track.
+// The output is a list of bytes to include in an array, like song/song.h.
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#include "yarns/multi.h"
+#include "yarns/song_bank.h"
+#include "yarns/tools/smf_file.h"
+
+using namespace std;
+using namespace yarns;
+
+const uint32_t kClockResolution = 24;  // Clock ticks per quarter note.
+const size_t kBytesPerLine = 16;
+
+struct PartEvent {
+  uint32_t time;  // In clock ticks.
+  uint8_t part;
+  uint8_t note;
+  uint8_t velocity;  // 0 for note off.
+};
+
+void AppendWait(uint32_t duration, vector<uint8_t>* data) {
+  while (duration) {
+    uint32_t wait = min(duration, static_cast<uint32_t>(kSongMaxWait));
+    data->push_back(SONG_OPCODE_WAIT + wait - 1);
+    duration -= wait;
+  }
+}
+
+void PackSong(const SmfFile& smf, vector<uint8_t>* entry) {
+  uint32_t division = smf.division;
+  vector<PartEvent> events;
+  uint8_t num_parts = 0;
+  uint32_t histogram[128] = { 0 };
+  for (size_t i = 0; i < smf.events.size(); ++i) {
+    const SmfEvent& e = smf.events[i];
+    uint8_t type = e.status & 0xf0;
+    uint8_t channel = e.status & 0x0f;
+    if ((type != 0x80 && type != 0x90) || channel >= kNumParts) {
+      continue;
+    }
+    PartEvent p;
+    p.time = (e.tick * kClockResolution + division / 2) / division;
+    p.part = channel;
+    p.note = e.data[0];
+    p.velocity = type == 0x90 ? e.data[1] : 0;
+    if (p.velocity) {
+      ++histogram[p.note];
+    }
+    num_parts = max(num_parts, static_cast<uint8_t>(channel + 1));
+    events.push_back(p);
+  }
+  
+  // Pick the range of notes which can be encoded with the short form of the
+  // note on event for as many notes as possible.
+  uint8_t base_note = 0;
+  uint32_t best_count = 0;
+  for (uint8_t base = 0; base + kSongShortNoteRange <= 128; ++base) {
+    uint32_t count = 0;
+    for (uint8_t i = 0; i < kSongShortNoteRange; ++i) {
+      count += histogram[base + i];
+    }
+    if (count > best_count) {
+      best_count = count;
+      base_note = base;
+    }
+  }
+  
+  uint8_t layout = num_parts <= 1
+      ? LAYOUT_MONO
+      : (num_parts == 2 ? LAYOUT_DUAL_MONO : LAYOUT_QUAD_MONO);
+  uint32_t tempo = smf.tempo_map.empty()
+      ? kSmfDefaultTempo
+      : smf.tempo_map[0].tempo;
+  uint32_t bpm = (60000000 + tempo / 2) / max(tempo, 1U);
+  bpm = min(max(bpm, 40U), 240U);
+  
+  entry->push_back(2);
+  entry->push_back(kSongTargetMulti);
+  entry->push_back(MULTI_LAYOUT);
+  entry->push_back(layout);
+  entry->push_back(kSongTargetMulti);
+  entry->push_back(MULTI_CLOCK_TEMPO);
+  entry->push_back(bpm);
+  entry->push_back(base_note);
+  
+  uint32_t time = 0;
+  uint8_t velocity = kSongDefaultVelocity;
+  for (size_t i = 0; i < events.size(); ++i) {
+    const PartEvent& e = events[i];
+    AppendWait(e.time - time, entry);
+    time = e.time;
+    if (!e.velocity) {
+      entry->push_back(SONG_OPCODE_NOTE_OFF + e.part);
+      entry->push_back(e.note);
+      continue;
+    }
+    if (e.velocity != velocity) {
+      velocity = e.velocity;
+      entry->push_back(SONG_OPCODE_VELOCITY);
+      entry->push_back(velocity);
+    }
+    if (e.note >= base_note && e.note < base_note + kSongShortNoteRange) {
+      entry->push_back(e.part * kSongShortNoteRange + e.note - base_note);
+    } else {
+      entry->push_back(SONG_OPCODE_NOTE_ON + e.part);
+      entry->push_back(e.note);
+    }
+  }
+  if (!events.empty()) {
+    // The loop must last at least one tick, otherwise the reader would never
+    // leave it.
+    uint32_t end = (smf.end_tick * kClockResolution + division / 2) / division;
+    AppendWait(max(end, max(time, 1U)) - time, entry);
+  }
+  entry->push_back(SONG_OPCODE_END);
+}
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    fprintf(stderr, "Usage: %s bank.h song.mid [song.mid ...]\n", argv[0]);
+    return 1;
+  }
+  
+  size_t num_entries = argc - 2;
+  if (num_entries > 255) {
+    fprintf(stderr, "Too many songs\n");
+    return 1;
+  }
+  vector<uint8_t> bank(1 + 2 * num_entries);
+  bank[0] = num_entries;
+  for (size_t i = 0; i < num_entries; ++i) {
+    const char* file_name = argv[i + 2];
+    SmfFile smf;
+    if (!ReadSmfFile(file_name, &smf)) {
+      fprintf(stderr, "Could not read %s\n", file_name);
+      return 1;
+    }
+    size_t offset = bank.size();
+    bank[1 + 2 * i] = offset & 0xff;
+    bank[2 + 2 * i] = offset >> 8;
+    PackSong(smf, &bank);
+    printf("%s: %lu events, %lu bytes\n",
+           file_name, smf.events.size(), bank.size() - offset);
+  }
+  if (bank.size() > 65535) {
+    fprintf(stderr, "The bank is too large: %lu bytes\n", bank.size());
+    return 1;
+  }
+  
+  FILE* fp = fopen(argv[1], "w");
+  if (!fp) {
+    fprintf(stderr, "Could not write %s\n", argv[1]);
+    return 1;
+  }
+  for (size_t i = 0; i < bank.size(); ++i) {
+    fprintf(fp, "%s%d,", i % kBytesPerLine ? " " : "  ", bank[i]);
+    if (i % kBytesPerLine == kBytesPerLine - 1 || i == bank.size() - 1) {
+      fprintf(fp, "\n");
+    }
+  }
+  fclose(fp);
+  return 0;
+}
@@ -604,7 +604,7 @@ void Ui::OnSwitchPress(const Event& e) {
             if (!multi.running()) {
               multi.Start(false);
               if (multi.paques()) {
-                multi.StartSong();
+                multi.StartSong(0);
               }
             } else {
               multi.Stop();
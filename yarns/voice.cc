@@ -281,33 +281,38 @@ uint32_t Oscillator::ComputePhaseIncrement(int16_t midi_pitch) {
   return phase_increment;
 }
 
-void Oscillator::RenderSilence() {
-  size_t size = kAudioBlockSize;
-  while (size--) {
-    audio_buffer_.Overwrite(offset_);
-  }
+void Oscillator::RenderSilence(uint16_t* out) {
+  std::fill(&out[0], &out[kAudioBlockSize], offset_);
 }
 
-void Oscillator::RenderSine(uint32_t phase_increment) {
+void Oscillator::RenderSine(uint32_t phase_increment, uint16_t* out) {
+  uint32_t phase = phase_;
+  int32_t scale = scale_;
+  int32_t offset = offset_;
   size_t size = kAudioBlockSize;
   while (size--) {
-    phase_ += phase_increment;
-    int32_t sample = Interpolate1022(wav_sine, phase_);
-    audio_buffer_.Overwrite(offset_ - (scale_ * sample >> 16));
+    phase += phase_increment;
+    int32_t sample = Interpolate1022(wav_sine, phase);
+    *out++ = offset - (scale * sample >> 16);
   }
+  phase_ = phase;
 }
 
-void Oscillator::RenderNoise() {
+void Oscillator::RenderNoise(uint16_t* out) {
+  int32_t scale = scale_;
+  int32_t offset = offset_;
   size_t size = kAudioBlockSize;
   while (size--) {
     int16_t sample = Random::GetSample();
-    audio_buffer_.Overwrite(offset_ - (scale_ * sample >> 16));
+    *out++ = offset - (scale * sample >> 16);
   }
 }
 
-void Oscillator::RenderSaw(uint32_t phase_increment) {
+void Oscillator::RenderSaw(uint32_t phase_increment, uint16_t* out) {
   uint32_t phase = phase_;
   int32_t next_sample = next_sample_;
+  int32_t scale = scale_;
+  int32_t offset = offset_;
   size_t size = kAudioBlockSize;
 
   while (size--) {
@@ -321,7 +326,7 @@ void Oscillator::RenderSaw(uint32_t phase_increment) {
     }
     next_sample += phase >> 17;
     this_sample = (this_sample - 16384) << 1;
-    audio_buffer_.Overwrite(offset_ - (scale_ * this_sample >> 16));
+    *out++ = offset - (scale * this_sample >> 16);
   }
   next_sample_ = next_sample;
   phase_ = phase;
@@ -330,11 +335,15 @@ void Oscillator::RenderSaw(uint32_t phase_increment) {
 void Oscillator::RenderSquare(
     uint32_t phase_increment,
     uint32_t pw,
-    bool integrate) {
+    bool integrate,
+    uint16_t* out) {
   uint32_t phase = phase_;
   int32_t next_sample = next_sample_;
   int32_t integrator_state = integrator_state_;
   int16_t integrator_coefficient = phase_increment >> 18;
+  int32_t scale = scale_;
+  int32_t offset = offset_;
+  bool high = high_;
   size_t size = kAudioBlockSize;
 
   while (size--) {
@@ -342,19 +351,19 @@ void Oscillator::RenderSquare(
     next_sample = 0;
     phase += phase_increment;
 
-    if (!high_) {
+    if (!high) {
       if (phase >= pw) {
         uint32_t t = (phase - pw) / (phase_increment >> 16);
         this_sample += ThisBlepSample(t);
         next_sample += NextBlepSample(t);
-        high_ = true;
+        high = true;
       }
     }
-    if (high_ && (phase < phase_increment)) {
+    if (high && (phase < phase_increment)) {
       uint32_t t = phase / (phase_increment >> 16);
       this_sample -= ThisBlepSample(t);
       next_sample -= NextBlepSample(t);
-      high_ = false;
+      high = false;
     }
     next_sample += phase < pw ? 0 : 32767;
     this_sample = (this_sample - 16384) << 1;
@@ -362,8 +371,9 @@ void Oscillator::RenderSquare(
       integrator_state += integrator_coefficient * (this_sample - integrator_state) >> 15;
       this_sample = integrator_state << 3;
     }
-    audio_buffer_.Overwrite(offset_ - (scale_ * this_sample >> 16));
+    *out++ = offset - (scale * this_sample >> 16);
   }
+  high_ = high;
   integrator_state_ = integrator_state;
   next_sample_ = next_sample;
   phase_ = phase;
@@ -374,32 +384,33 @@ void Oscillator::Render(uint8_t mode, int16_t note, bool gate) {
     return;
   }
   
+  uint16_t block[kAudioBlockSize];
   if ((mode & 0x80) && !gate) {
-    RenderSilence();
-    return;
-  }
-  
-  uint32_t phase_increment = ComputePhaseIncrement(note);
-  switch ((mode & 0x0f) - 1) {
-    case 0:
-      RenderSaw(phase_increment);
-      break;
-    case 1:
-      RenderSquare(phase_increment, 0x40000000, false);
-      break;
-    case 2:
-      RenderSquare(phase_increment, 0x80000000, false);
-      break;
-    case 3:
-      RenderSquare(phase_increment, 0x80000000, true);
-      break;
-    case 4:
-      RenderSine(phase_increment);
-      break;
-    default:
-      RenderNoise();
-      break;
+    RenderSilence(block);
+  } else {
+    uint32_t phase_increment = ComputePhaseIncrement(note);
+    switch ((mode & 0x0f) - 1) {
+      case 0:
+        RenderSaw(phase_increment, block);
+        break;
+      case 1:
+        RenderSquare(phase_increment, 0x40000000, false, block);
+        break;
+      case 2:
+        RenderSquare(phase_increment, 0x80000000, false, block);
+        break;
+      case 3:
+        RenderSquare(phase_increment, 0x80000000, true, block);
+        break;
+      case 4:
+        RenderSine(phase_increment, block);
+        break;
+      default:
+        RenderNoise(block);
+        break;
+    }
   }
+  audio_buffer_.Overwrite(block, kAudioBlockSize);
 }
 
 }  // namespace yarns
\ No newline at end of file
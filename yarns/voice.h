@@ -67,11 +67,17 @@ class Oscillator {
  private:
   uint32_t ComputePhaseIncrement(int16_t pitch);
   
-  void RenderSilence();
-  void RenderNoise();
-  void RenderSine(uint32_t phase_increment);
-  void RenderSaw(uint32_t phase_increment);
-  void RenderSquare(uint32_t phase_increment, uint32_t pw, bool integrate);
+  // The waveforms are rendered as DAC codes into a block on the stack, which
+  // is then copied to the audio buffer in one go.
+  void RenderSilence(uint16_t* out);
+  void RenderNoise(uint16_t* out);
+  void RenderSine(uint32_t phase_increment, uint16_t* out);
+  void RenderSaw(uint32_t phase_increment, uint16_t* out);
+  void RenderSquare(
+      uint32_t phase_increment,
+      uint32_t pw,
+      bool integrate,
+      uint16_t* out);
 
   inline int32_t ThisBlepSample(uint32_t t) {
     if (t > 65535) {